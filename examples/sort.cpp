@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <string>
+#include <ityr/ityr.hpp>
+
+// Compares ityr::sort() (merge sort), ityr::sort() with sample sort, and ityr::radix_sort()
+// on uniformly distributed 64-bit keys.
+// Usage: ityr_sort.out [n] [repeats] [cutoff]
+// Large inputs need ITYR_ORI_NONCOLL_ALLOCATOR_SIZE to be large enough for the temporary buffers
+// of sample sort and radix sort (n * 8 bytes in total over all processes).
+
+static void init_keys(ityr::global_span<uint64_t> s) {
+   ityr::transform(ityr::execution::par, ityr::count_iterator<uint64_t>(0),
+                   ityr::count_iterator<uint64_t>(s.size()), s.begin(),
+                   [](uint64_t i) {
+                      uint64_t x = i + 0x9e3779b97f4a7c15;
+                      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+                      x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+                      return x ^ (x >> 31);
+                   });
+}
+
+template <typename SortFn>
+static void run(const char* name, ityr::global_span<uint64_t> s, int repeats, SortFn sort_fn) {
+   for (int r = 0; r < repeats; r++) {
+      ityr::root_exec([=] { init_keys(s); });
+
+      auto t0 = ityr::gettime_ns();
+      ityr::root_exec([=] { sort_fn(s); });
+      auto t1 = ityr::gettime_ns();
+
+      bool sorted = ityr::root_exec([=] {
+         return ityr::is_sorted(ityr::execution::par, s.begin(), s.end());
+      });
+
+      if (ityr::is_master()) {
+         printf("[%s] %d: %.3f s (%s)\n", name, r, (t1 - t0) / 1e9, sorted ? "OK" : "NOT SORTED");
+         fflush(stdout);
+      }
+   }
+}
+
+int main(int argc, char** argv) {
+   ityr::init();
+
+   const std::size_t n = argc > 1 ? std::stoull(argv[1]) : 10000000;
+   const int repeats = argc > 2 ? std::stoi(argv[2]) : 3;
+   const std::size_t cutoff = argc > 3 ? std::stoull(argv[3]) : 16384;
+
+   if (ityr::is_master()) {
+      printf("n = %zu, repeats = %d, cutoff = %zu, processes = %d\n",
+             n, repeats, cutoff, ityr::n_ranks());
+      fflush(stdout);
+   }
+
+   {
+      ityr::global_vector<uint64_t> v(ityr::global_vector_options(true), n);
+      ityr::global_span<uint64_t> s(v);
+
+      auto policy = ityr::execution::parallel_policy(cutoff);
+
+      run("merge sort", s, repeats, [=](ityr::global_span<uint64_t> s) {
+         ityr::sort(policy, s.begin(), s.end());
+      });
+
+      run("sample sort", s, repeats, [=](ityr::global_span<uint64_t> s) {
+         ityr::sort(policy.with_sample_sort(), s.begin(), s.end());
+      });
+
+      run("radix sort", s, repeats, [=](ityr::global_span<uint64_t> s) {
+         ityr::radix_sort(policy, s.begin(), s.end());
+      });
+   }
+
+   ityr::fini();
+}
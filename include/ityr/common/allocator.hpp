@@ -446,6 +446,18 @@ T remote_faa_value(const remotable_resource& rmr, const T& val, T* target_p) {
   return mpi_atomic_faa_value(val, target_rank, rmr.get_disp(target_p), rmr.win());
 }
 
+template <typename T>
+T remote_cas_value(const remotable_resource& rmr, const T& val, const T& compare, T* target_p) {
+  auto target_rank = rmr.get_owner(target_p);
+  return mpi_atomic_cas_value(val, compare, target_rank, rmr.get_disp(target_p), rmr.win());
+}
+
+template <typename T>
+T remote_swap_value(const remotable_resource& rmr, const T& val, T* target_p) {
+  auto target_rank = rmr.get_owner(target_p);
+  return mpi_atomic_put_value(val, target_rank, rmr.get_disp(target_p), rmr.win());
+}
+
 // Tests
 // -----------------------------------------------------------------------------
 
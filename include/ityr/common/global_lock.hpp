@@ -46,8 +46,11 @@ public:
       return;
     }
 
-    // Wait until the previous lock holder releases the lock
-    while (mpi_atomic_get_value<lock_t>(target_rank, get_disp(idx), lock_win_.win()) != 1);
+    // Wait until the previous lock holder releases the lock; the holder may be accessing this
+    // process's memory, which may need progress on this process to complete
+    while (mpi_atomic_get_value<lock_t>(target_rank, get_disp(idx), lock_win_.win()) != 1) {
+      mpi_make_progress();
+    }
   }
 
   void unlock(topology::rank_t target_rank, int idx = 0) const {
@@ -224,6 +224,31 @@ inline T mpi_atomic_faa_value(const T&    value,
   return result;
 }
 
+// Element-wise atomic add without fetching the old values (`origin` must not be modified until flush)
+template <typename T>
+inline void mpi_atomic_add_nb(const T*    origin,
+                              std::size_t count,
+                              int         target_rank,
+                              std::size_t target_disp,
+                              MPI_Win     win) {
+  ITYR_PROFILER_RECORD(prof_event_mpi_rma_atomic_add, target_rank);
+#if ITYR_DEBUG_UCX
+  ucs_trace_func("origin: %d, target: %d, %ld bytes", topology::my_rank(), target_rank, sizeof(T) * count);
+#endif
+  ITYR_CHECK(win != MPI_WIN_NULL);
+  RMA_FAA_DATA_SIZE += sizeof(T) * count;
+  RMA_FAA_DATA_CALLS++;
+  MPI_Accumulate(origin,
+                 count,
+                 mpi_type<T>(),
+                 target_rank,
+                 target_disp,
+                 count,
+                 mpi_type<T>(),
+                 MPI_SUM,
+                 win);
+}
+
 template <typename T>
 inline void mpi_atomic_cas_nb(const T*    origin,
                               const T*    compare,
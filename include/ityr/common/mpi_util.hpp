@@ -22,6 +22,10 @@ template <>           inline MPI_Datatype mpi_type<int>()           { return MPI
 template <>           inline MPI_Datatype mpi_type<unsigned int>()  { return MPI_UNSIGNED;          }
 template <>           inline MPI_Datatype mpi_type<long>()          { return MPI_LONG;              }
 template <>           inline MPI_Datatype mpi_type<unsigned long>() { return MPI_UNSIGNED_LONG;     }
+template <>           inline MPI_Datatype mpi_type<long long>()     { return MPI_LONG_LONG;         }
+template <>           inline MPI_Datatype mpi_type<unsigned long long>() { return MPI_UNSIGNED_LONG_LONG; }
+template <>           inline MPI_Datatype mpi_type<float>()         { return MPI_FLOAT;             }
+template <>           inline MPI_Datatype mpi_type<double>()        { return MPI_DOUBLE;            }
 template <>           inline MPI_Datatype mpi_type<bool>()          { return MPI_CXX_BOOL;          }
 template <>           inline MPI_Datatype mpi_type<void*>()         { return mpi_type<uintptr_t>(); }
 
@@ -450,7 +454,12 @@ public:
     mpi_comm_root() = comm;
     MPI_Initialized(&initialized_outside_);
     if (!initialized_outside_) {
-      MPI_Init(nullptr, nullptr);
+      // A progress thread (ITYR_ENABLE_PROGRESS_THREAD) requires MPI_THREAD_MULTIPLE. The environment
+      // variable is read directly here because runtime options are broadcast via MPI.
+      int required = getenv_with_default("ITYR_ENABLE_PROGRESS_THREAD", false) ?
+                     MPI_THREAD_MULTIPLE : MPI_THREAD_SINGLE;
+      int provided;
+      MPI_Init_thread(nullptr, nullptr, required, &provided);
     }
 #if ITYR_DEBUG_UCX
     while (ucs_log_num_handlers() > 0) {
@@ -150,6 +150,18 @@ struct allocator_max_unflushed_free_objs_option : public option<allocator_max_un
   static std::size_t default_value() { return 10; }
 };
 
+struct enable_progress_thread_option : public option<enable_progress_thread_option, bool> {
+  using option::option;
+  static std::string name() { return "ITYR_ENABLE_PROGRESS_THREAD"; }
+  static bool default_value() { return false; }
+};
+
+struct progress_thread_interval_option : public option<progress_thread_interval_option, std::size_t> {
+  using option::option;
+  static std::string name() { return "ITYR_PROGRESS_THREAD_INTERVAL"; }
+  static std::size_t default_value() { return 10; }
+};
+
 struct runtime_options {
   option_initializer<enable_shared_memory_option>              ITYR_ANON_VAR;
   option_initializer<global_clock_sync_round_trips_option>     ITYR_ANON_VAR;
@@ -157,6 +169,8 @@ struct runtime_options {
   option_initializer<rma_use_mpi_win_allocate>                 ITYR_ANON_VAR;
   option_initializer<allocator_block_size_option>              ITYR_ANON_VAR;
   option_initializer<allocator_max_unflushed_free_objs_option> ITYR_ANON_VAR;
+  option_initializer<enable_progress_thread_option>            ITYR_ANON_VAR;
+  option_initializer<progress_thread_interval_option>          ITYR_ANON_VAR;
 };
 
 }
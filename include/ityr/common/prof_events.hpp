@@ -51,6 +51,11 @@ struct prof_event_mpi_rma_atomic_faa : public prof_event_target_base {
   std::string str() const override { return "mpi_rma_atomic_faa"; }
 };
 
+struct prof_event_mpi_rma_atomic_add : public prof_event_target_base {
+  using prof_event_target_base::prof_event_target_base;
+  std::string str() const override { return "mpi_rma_atomic_add"; }
+};
+
 struct prof_event_mpi_rma_atomic_cas : public prof_event_target_base {
   using prof_event_target_base::prof_event_target_base;
   std::string str() const override { return "mpi_rma_atomic_cas"; }
@@ -81,6 +86,11 @@ struct prof_event_rma_put_nb : public prof_event_target_base {
   std::string str() const override { return "rma_put_nb"; }
 };
 
+struct prof_event_rma_atomic_add_nb : public prof_event_target_base {
+  using prof_event_target_base::prof_event_target_base;
+  std::string str() const override { return "rma_atomic_add_nb"; }
+};
+
 struct prof_event_rma_flush : public common::profiler::event {
   using event::event;
   std::string str() const override { return "rma_flush"; }
@@ -129,12 +139,14 @@ private:
   profiler::event_initializer<prof_event_mpi_rma_get>           ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_put>           ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_atomic_faa>    ITYR_ANON_VAR;
+  profiler::event_initializer<prof_event_mpi_rma_atomic_add>    ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_atomic_cas>    ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_atomic_get>    ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_atomic_put>    ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_mpi_rma_flush>         ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_rma_get_nb>            ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_rma_put_nb>            ITYR_ANON_VAR;
+  profiler::event_initializer<prof_event_rma_atomic_add_nb>     ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_rma_flush>             ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_global_lock_trylock>   ITYR_ANON_VAR;
   profiler::event_initializer<prof_event_global_lock_priolock>  ITYR_ANON_VAR;
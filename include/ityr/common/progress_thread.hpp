@@ -0,0 +1,75 @@
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include "ityr/common/util.hpp"
+#include "ityr/common/mpi_util.hpp"
+#include "ityr/common/options.hpp"
+#include "ityr/common/logger.hpp"
+
+namespace ityr::common::progress_thread {
+
+// A helper thread that periodically makes MPI progress on behalf of the worker of this process.
+// Some RMA implementations need the target process to call into MPI for one-sided operations
+// (e.g., steals and lazy release requests from other processes) to complete; without this thread,
+// they stall while the worker is executing a long leaf task without calling MPI.
+class progress_thread {
+public:
+  progress_thread()
+    : enabled_(enable_progress_thread_option::value()),
+      interval_(progress_thread_interval_option::value()) {
+    if (enabled_) {
+      int provided;
+      MPI_Query_thread(&provided);
+      if (provided < MPI_THREAD_MULTIPLE) {
+        die("[ityr::common::progress_thread] ITYR_ENABLE_PROGRESS_THREAD=1 requires MPI_THREAD_MULTIPLE. "
+            "If MPI is initialized outside Itoyori, use MPI_Init_thread() to request it.");
+      }
+      th_ = std::thread([this] { loop(); });
+      verbose("Progress thread started (interval = %ld us)", interval_);
+    }
+  }
+
+  ~progress_thread() {
+    if (enabled_) {
+      stop_.store(true, std::memory_order_relaxed);
+      th_.join();
+      verbose("Progress thread stopped (%ld polls)", n_polls_);
+    }
+  }
+
+  progress_thread(const progress_thread&) = delete;
+  progress_thread& operator=(const progress_thread&) = delete;
+
+  progress_thread(progress_thread&&) = delete;
+  progress_thread& operator=(progress_thread&&) = delete;
+
+  bool enabled() const { return enabled_; }
+
+private:
+  void loop() {
+    while (!stop_.load(std::memory_order_relaxed)) {
+      mpi_make_progress();
+      n_polls_++;
+      if (interval_ > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(interval_));
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  bool              enabled_;
+  std::size_t       interval_;
+  std::atomic<bool> stop_ = false;
+  std::size_t       n_polls_ = 0;
+  std::thread       th_;
+};
+
+using instance = singleton<progress_thread>;
+
+inline bool enabled() { return instance::get().enabled(); }
+
+}
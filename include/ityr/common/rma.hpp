@@ -73,6 +73,18 @@ inline void put_nb(const T*    origin_addr,
                          target_win, target_rank, target_disp);
 }
 
+// Element-wise atomic add to the target memory (`origin_addr` must not be modified until flush)
+template <typename T>
+inline void atomic_add_nb(const T*    origin_addr,
+                          std::size_t count,
+                          const win&  target_win,
+                          int         target_rank,
+                          std::size_t target_disp) {
+  static_assert(std::is_arithmetic_v<T>);
+  ITYR_PROFILER_RECORD(prof_event_rma_atomic_add_nb, target_rank);
+  instance::get().atomic_add_nb(origin_addr, count, target_win, target_rank, target_disp);
+}
+
 inline void flush(const win& target_win) {
   ITYR_PROFILER_RECORD(prof_event_rma_flush);
   instance::get().flush(target_win);
@@ -49,6 +49,15 @@ public:
     mpi_put_nb(origin_addr, bytes, target_rank, target_disp, target_win.win());
   }
 
+  template <typename T>
+  void atomic_add_nb(const T*    origin_addr,
+                     std::size_t count,
+                     const win&  target_win,
+                     int         target_rank,
+                     std::size_t target_disp) {
+    mpi_atomic_add_nb(origin_addr, count, target_rank, target_disp, target_win.win());
+  }
+
   void flush(const win& win) {
     mpi_win_flush_all(win.win());
   }
@@ -145,6 +145,11 @@ public:
     common::die("utofu rma layer is not supported for get/put (nocache) interface");
   }
 
+  template <typename T>
+  void atomic_add_nb(const T*, std::size_t, const win&, int, std::size_t) {
+    common::die("utofu rma layer is not supported for atomic operations");
+  }
+
   void flush(const win&) {
     // TODO: flush for each win
     for (int i = 0; i < n_ongoing_tcq_reqs_; i++) {
@@ -25,6 +25,23 @@ public:
     ITYR_CHECK(common::is_pow2(n_leaves));
   }
 
+  // Initialize all work hints with the same value (e.g., for learning work hints)
+  workhint_range(std::size_t n_leaves, const W& init_value)
+    : workhint_range(n_leaves) {
+    auto fill_fn = [=, p = bin_tree_, n = size()] {
+      for_each(
+          execution::par,
+          make_global_iterator(p    , checkout_mode::write),
+          make_global_iterator(p + n, checkout_mode::write),
+          [=](bin_tree_node& node) { node = {init_value, init_value}; });
+    };
+    if (ito::is_spmd()) {
+      root_exec(fill_fn);
+    } else {
+      fill_fn();
+    }
+  }
+
   ~workhint_range() { destroy(); }
 
   workhint_range(const workhint_range&) = delete;
@@ -269,4 +286,48 @@ ITYR_TEST_CASE("[ityr::workhint] workhint range test") {
   ito::fini();
 }
 
+ITYR_TEST_CASE("[ityr::workhint] learn workhint range") {
+  ito::init();
+  ori::init();
+
+  long n = 1024;
+
+  {
+    workhint_range<double> workhint(64, 1.0);
+
+    root_exec([&] {
+      auto [w1, w2] = workhint.view().get_workhint();
+      ITYR_CHECK(w1 == 1.0);
+      ITYR_CHECK(w2 == 1.0);
+
+      // Only the second half of the range has work
+      auto busy_loop = [=](long i) {
+        if (i >= n / 2) {
+          auto t0 = common::clock_gettime_ns();
+          while (common::clock_gettime_ns() - t0 < 10000);
+        }
+      };
+
+      for (int it = 0; it < 3; it++) {
+        for_each(
+            execution::parallel_policy(4, workhint).with_workhint_learning(),
+            count_iterator<long>(0),
+            count_iterator<long>(n),
+            busy_loop);
+
+        auto [lw1, lw2] = workhint.view().get_workhint();
+        ITYR_CHECK(lw1 < lw2);
+
+        auto [c1, c2] = workhint.view().get_children();
+        auto [lw21, lw22] = c2.get_workhint();
+        ITYR_CHECK(lw21 > 0);
+        ITYR_CHECK(lw22 > 0);
+      }
+    });
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <sys/mman.h>
+#include <signal.h>
 #include <optional>
+#include <vector>
 
 #include "ityr/common/util.hpp"
 #include "ityr/common/mpi_util.hpp"
@@ -11,29 +14,74 @@
 
 namespace ityr::ito {
 
+// The call stack is reserved at the same virtual address on all processes, and its lowest
+// `guard_size` bytes are left inaccessible to detect stack overflow. Physical pages (shared memory)
+// are committed on first touch, and thus a large stack costs little unless it is actually used.
 class callstack {
 public:
-  callstack(std::size_t size)
-    : vm_(common::reserve_same_vm_coll(size, common::get_page_size())),
+  callstack(std::size_t size, std::size_t guard_size)
+    : guard_size_(common::round_up_pow2(guard_size, common::get_page_size())),
+      vm_(common::reserve_same_vm_coll(guard_size_ + size, common::get_page_size())),
       pm_(init_stack_pm()),
-      win_(common::topology::mpicomm(), reinterpret_cast<std::byte*>(vm_.addr()), vm_.size()) {}
+      win_(common::topology::mpicomm(), reinterpret_cast<std::byte*>(top()), this->size()) {
+    install_guard_handler();
+  }
+
+  ~callstack() {
+    uninstall_guard_handler();
+  }
+
+  callstack(const callstack&) = delete;
+  callstack& operator=(const callstack&) = delete;
+
+  callstack(callstack&&) = delete;
+  callstack& operator=(callstack&&) = delete;
 
-  void* top() const { return vm_.addr(); }
+  void* top() const { return reinterpret_cast<std::byte*>(vm_.addr()) + guard_size_; }
   void* bottom() const { return reinterpret_cast<std::byte*>(vm_.addr()) + vm_.size(); }
-  std::size_t size() const { return vm_.size(); }
+  std::size_t size() const { return vm_.size() - guard_size_; }
 
   void direct_copy_from(void*                    addr,
                         std::size_t              size,
                         common::topology::rank_t target_rank) const {
     ITYR_CHECK(target_rank != common::topology::my_rank());
     ITYR_CHECK(target_rank < common::topology::n_ranks());
-    ITYR_CHECK(vm_.addr() <= addr);
-    ITYR_CHECK(reinterpret_cast<std::byte*>(addr) + size <= reinterpret_cast<std::byte*>(vm_.addr()) + vm_.size());
+    ITYR_CHECK(top() <= addr);
+    ITYR_CHECK(reinterpret_cast<std::byte*>(addr) + size <= reinterpret_cast<std::byte*>(bottom()));
 
-    auto target_disp = reinterpret_cast<uintptr_t>(addr) - reinterpret_cast<uintptr_t>(vm_.addr());
+    auto target_disp = reinterpret_cast<uintptr_t>(addr) - reinterpret_cast<uintptr_t>(top());
     common::mpi_get(reinterpret_cast<std::byte*>(addr), size, target_rank, target_disp, win_.win());
   }
 
+  // The maximum depth of the stack used so far on this process (in bytes). Stack frames copied
+  // from other processes by steals are also counted. The deepest written word is searched only in
+  // the committed pages, so as not to commit more pages (pages may have been committed without
+  // being written, e.g., when the MPI library registers the stack region for RDMA).
+  std::size_t high_water_mark() const {
+    std::size_t pagesize = common::get_page_size();
+    std::size_t n_pages = size() / pagesize;
+
+    std::vector<unsigned char> resident(n_pages);
+    if (mincore(top(), size(), resident.data()) == -1) {
+      perror("mincore");
+      common::die("[ityr::ito::callstack] mincore() failed");
+    }
+
+    // The stack grows from the bottom (higher address) to the top (lower address)
+    for (std::size_t i = 0; i < n_pages; i++) {
+      if (resident[i] & 1) {
+        const uint64_t* page = reinterpret_cast<const uint64_t*>(
+            reinterpret_cast<std::byte*>(top()) + i * pagesize);
+        for (std::size_t j = 0; j < pagesize / sizeof(uint64_t); j++) {
+          if (page[j] != 0) {
+            return size() - i * pagesize - j * sizeof(uint64_t);
+          }
+        }
+      }
+    }
+    return 0;
+  }
+
 private:
   static std::string stack_shmem_name(int rank) {
     std::stringstream ss;
@@ -42,14 +90,65 @@ private:
   }
 
   common::physical_mem init_stack_pm() {
-    common::physical_mem pm(stack_shmem_name(common::topology::my_rank()), vm_.size(), true);
-    pm.map_to_vm(vm_.addr(), vm_.size(), 0);
+    common::physical_mem pm(stack_shmem_name(common::topology::my_rank()), size(), true);
+    pm.map_to_vm(top(), size(), 0);
     return pm;
   }
 
+  // The signal handler runs on an alternate stack, as the call stack is exhausted on overflow
+  static constexpr std::size_t altstack_size = 64 * 1024;
+
+  inline static std::byte*       guard_begin_ = nullptr;
+  inline static std::byte*       guard_end_   = nullptr;
+  inline static struct sigaction prev_sigsegv_action_;
+  inline static stack_t          prev_altstack_;
+
+  void install_guard_handler() {
+    guard_begin_ = reinterpret_cast<std::byte*>(vm_.addr());
+    guard_end_   = reinterpret_cast<std::byte*>(top());
+
+    altstack_.resize(altstack_size);
+    stack_t ss {};
+    ss.ss_sp    = altstack_.data();
+    ss.ss_size  = altstack_.size();
+    ss.ss_flags = 0;
+    if (sigaltstack(&ss, &prev_altstack_) == -1) {
+      perror("sigaltstack");
+      common::die("[ityr::ito::callstack] sigaltstack() failed");
+    }
+
+    struct sigaction sa {};
+    sa.sa_sigaction = guard_handler;
+    sa.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGSEGV, &sa, &prev_sigsegv_action_) == -1) {
+      perror("sigaction");
+      common::die("[ityr::ito::callstack] sigaction() failed");
+    }
+  }
+
+  void uninstall_guard_handler() {
+    sigaction(SIGSEGV, &prev_sigsegv_action_, nullptr);
+    sigaltstack(&prev_altstack_, nullptr);
+    guard_begin_ = nullptr;
+    guard_end_   = nullptr;
+  }
+
+  static void guard_handler(int, siginfo_t* info, void*) {
+    std::byte* addr = reinterpret_cast<std::byte*>(info->si_addr);
+    if (guard_begin_ <= addr && addr < guard_end_) {
+      common::die("[ityr::ito::callstack] Stack overflow (accessed %p in the guard region) on rank %d; "
+                  "try a larger stack size (ITYR_ITO_STACK_SIZE)", addr, common::topology::my_rank());
+    }
+    // Not a stack overflow; the faulting access is retried with the previous handler
+    sigaction(SIGSEGV, &prev_sigsegv_action_, nullptr);
+  }
+
+  std::size_t                        guard_size_;
   common::virtual_mem                vm_;
   common::physical_mem               pm_;
   common::mpi_win_manager<std::byte> win_;
+  std::vector<std::byte>             altstack_;
 };
 
 }
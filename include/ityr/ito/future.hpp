@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ityr/common/util.hpp"
+#include "ityr/common/topology.hpp"
+#include "ityr/ito/worker.hpp"
+#include "ityr/ito/scheduler.hpp"
+#include "ityr/ito/thread.hpp"
+
+namespace ityr::ito {
+
+// A handle to the result of an async thread. Unlike `thread`, futures can be copied, passed to
+// other threads, and waited for by any number of threads (not necessarily by the parent).
+// The result is copied to each waiter, and thus it must be trivially copyable.
+template <typename T>
+class future {
+  // If the return value is void, set `no_retval_t` as the return type for the internal of the scheduler
+  using sched_retval_t = std::conditional_t<std::is_void_v<T>, no_retval_t, T>;
+
+  static_assert(std::is_trivially_copyable_v<sched_retval_t>,
+                "The result of a future must be trivially copyable");
+
+public:
+  future() {}
+
+  future(const future& f) : handler_(f.handler_), valid_(f.valid_) {
+    if (valid_) {
+      worker::instance::get().sched().template future_retain<sched_retval_t>(handler_);
+    }
+  }
+  future& operator=(const future& f) {
+    if (this != &f) {
+      reset();
+      handler_ = f.handler_;
+      valid_   = f.valid_;
+      if (valid_) {
+        worker::instance::get().sched().template future_retain<sched_retval_t>(handler_);
+      }
+    }
+    return *this;
+  }
+
+  future(future&& f) : handler_(f.handler_), valid_(std::exchange(f.valid_, false)) {}
+  future& operator=(future&& f) {
+    if (this != &f) {
+      reset();
+      handler_ = f.handler_;
+      valid_   = std::exchange(f.valid_, false);
+    }
+    return *this;
+  }
+
+  ~future() { reset(); }
+
+  template <typename OnDriftForkCallback, typename OnDieCallback, typename Fn, typename... Args>
+  void spawn(with_callback_t, OnDriftForkCallback on_drift_fork_cb, OnDieCallback on_die_cb,
+             Fn&& fn, Args&&... args) {
+    auto& w = worker::instance::get();
+    ITYR_CHECK(!w.is_spmd());
+    reset();
+    w.sched().template async<sched_retval_t>(handler_, on_drift_fork_cb, on_die_cb,
+                                             std::forward<Fn>(fn), std::forward<Args>(args)...);
+    valid_ = true;
+  }
+
+  bool valid() const { return valid_; }
+
+  bool ready() const {
+    ITYR_CHECK(valid_);
+    return worker::instance::get().sched().template future_ready<sched_retval_t>(handler_);
+  }
+
+  // Block the current thread until the result is available; can be called multiple times
+  T get() const {
+    auto& w = worker::instance::get();
+    ITYR_CHECK(!w.is_spmd());
+    ITYR_CHECK(valid_);
+    if constexpr (std::is_void_v<T>) {
+      w.sched().template future_get<sched_retval_t>(handler_);
+    } else {
+      return w.sched().template future_get<sched_retval_t>(handler_);
+    }
+  }
+
+  void reset() {
+    if (valid_) {
+      worker::instance::get().sched().template future_release<sched_retval_t>(handler_);
+      valid_ = false;
+    }
+  }
+
+private:
+  scheduler::future_handler<sched_retval_t> handler_ {};
+  bool                                      valid_ = false;
+};
+
+template <typename Fn, typename... Args>
+inline auto async(Fn&& fn, Args&&... args) {
+  return async(with_callback, nullptr, nullptr, std::forward<Fn>(fn), std::forward<Args>(args)...);
+}
+
+template <typename OnDriftForkCallback, typename OnDieCallback, typename Fn, typename... Args>
+inline auto async(with_callback_t, OnDriftForkCallback on_drift_fork_cb, OnDieCallback on_die_cb,
+                  Fn&& fn, Args&&... args) {
+  future<std::invoke_result_t<Fn, Args...>> f;
+  f.spawn(with_callback, on_drift_fork_cb, on_die_cb,
+          std::forward<Fn>(fn), std::forward<Args>(args)...);
+  return f;
+}
+
+}
@@ -7,10 +7,12 @@
 #include "ityr/common/topology.hpp"
 #include "ityr/common/wallclock.hpp"
 #include "ityr/common/profiler.hpp"
+#include "ityr/common/progress_thread.hpp"
 #include "ityr/common/prof_events.hpp"
 #include "ityr/ito/util.hpp"
 #include "ityr/ito/options.hpp"
 #include "ityr/ito/thread.hpp"
+#include "ityr/ito/future.hpp"
 #include "ityr/ito/worker.hpp"
 #include "ityr/ito/prof_events.hpp"
 
@@ -28,6 +30,7 @@ private:
   common::singleton_initializer<common::topology::instance>  topo_;
   common::singleton_initializer<common::wallclock::instance> clock_;
   common::singleton_initializer<common::profiler::instance>  prof_;
+  common::singleton_initializer<common::progress_thread::instance> progress_thread_;
   common::prof_events                                        common_prof_events_;
 
   runtime_options                                            ito_opts_;
@@ -58,6 +61,19 @@ inline auto root_exec(with_callback_t, SchedLoopCallback cb, Fn&& fn, Args&&...
   return w.root_exec(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
 }
 
+// Every process starts its own root thread, and the result of that root thread is returned
+template <typename Fn, typename... Args>
+inline auto root_exec_each(Fn&& fn, Args&&... args) {
+  return root_exec_each(with_callback, nullptr, std::forward<Fn>(fn), std::forward<Args>(args)...);
+}
+
+template <typename SchedLoopCallback, typename Fn, typename... Args>
+inline auto root_exec_each(with_callback_t, SchedLoopCallback cb, Fn&& fn, Args&&... args) {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(w.is_spmd());
+  return w.root_exec_each(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
+}
+
 inline bool is_spmd() {
   auto& w = worker::instance::get();
   return w.is_spmd();
@@ -68,6 +84,13 @@ inline bool is_root() {
   return w.sched().is_executing_root();
 }
 
+// Whether the scheduler requests lazily split loops to expose parallelism now
+inline bool should_split() {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(!w.is_spmd());
+  return w.sched().should_split();
+}
+
 template <typename Fn, typename... Args>
 inline auto coll_exec(const Fn& fn, const Args&... args) {
   ITYR_CHECK(!is_spmd());
@@ -76,12 +99,24 @@ inline auto coll_exec(const Fn& fn, const Args&... args) {
   return w.coll_exec(fn, args...);
 }
 
+using worker::coll_exec_handle;
+
+// The returned handle must be waited for before the next coll_exec() is issued.
+template <typename Fn, typename... Args>
+inline auto coll_exec_nb(const Fn& fn, const Args&... args) {
+  ITYR_CHECK(!is_spmd());
+  ITYR_CHECK(is_root());
+  auto& w = worker::instance::get();
+  return w.coll_exec_nb(fn, args...);
+}
+
 template <typename PreSuspendCallback, typename PostSuspendCallback>
 inline void migrate_to(common::topology::rank_t target_rank,
                        PreSuspendCallback&&     pre_suspend_cb,
                        PostSuspendCallback&&    post_suspend_cb) {
   ITYR_CHECK(!is_spmd());
-  ITYR_CHECK(is_root());
+  // The ADWS scheduler supports migration of the root thread only
+  ITYR_CHECK((is_root() || !std::is_same_v<scheduler, scheduler_adws>));
   auto& w = worker::instance::get();
   w.sched().migrate_to(target_rank,
                        std::forward<PreSuspendCallback>(pre_suspend_cb),
@@ -117,6 +152,49 @@ inline void task_group_end(PreSuspendCallback&&  pre_suspend_cb,
                            std::forward<PostSuspendCallback>(post_suspend_cb));
 }
 
+using cancel_handler = scheduler::cancel_handler;
+
+// Cancellation is cooperative: tasks are associated with positions and are expected to poll
+// is_cancelled() at task boundaries and skip their work once cancelled.
+inline cancel_handler cancel_scope_begin() {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(!w.is_spmd());
+  return w.sched().cancel_scope_begin();
+}
+
+// Must be called after all tasks in the scope are joined
+inline void cancel_scope_end(cancel_handler ch) {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(!w.is_spmd());
+  w.sched().cancel_scope_end(ch);
+}
+
+// Cancel the tasks at positions `pos` or later (all tasks by default)
+inline void cancel(cancel_handler ch, std::size_t pos = 0) {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(!w.is_spmd());
+  w.sched().cancel(ch, pos);
+}
+
+// Whether the task at position `pos` is cancelled
+inline bool is_cancelled(cancel_handler ch, std::size_t pos) {
+  auto& w = worker::instance::get();
+  ITYR_CHECK(!w.is_spmd());
+  ITYR_CHECK(pos < std::numeric_limits<std::size_t>::max());
+  return w.sched().is_cancelled(ch, pos);
+}
+
+// Whether any task is cancelled
+inline bool is_cancelled(cancel_handler ch) {
+  return is_cancelled(ch, std::numeric_limits<std::size_t>::max() - 1);
+}
+
+// The maximum depth of the call stack used so far on this process (in bytes)
+inline std::size_t stack_high_water_mark() {
+  auto& w = worker::instance::get();
+  return w.sched().stack_high_water_mark();
+}
+
 inline void dag_prof_begin() {
   auto& w = worker::instance::get();
   ITYR_CHECK(w.is_spmd());
@@ -155,6 +233,207 @@ ITYR_TEST_CASE("[ityr::ito] fib") {
   fini();
 }
 
+ITYR_TEST_CASE("[ityr::ito] fib with steal backoff and hint") {
+  sched_steal_backoff_option::set(true);
+  sched_steal_hint_option::set(true);
+  init();
+
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      thread<int> th([=]{ return fib(n - 1); });
+      int y = fib(n - 2);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int r = root_exec(fib, 15);
+    ITYR_CHECK(r == 987);
+  }
+
+  fini();
+  sched_steal_hint_option::unset();
+  sched_steal_backoff_option::unset();
+}
+
+ITYR_TEST_CASE("[ityr::ito] fib with task priorities") {
+  sched_steal_priority_samples_option::set(4);
+  init();
+
+  // The larger subtree is given a higher priority
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      thread<int> th(task_priority(n - 1), [=]{ return fib(n - 1); });
+      thread<int> th_hf(fork_policy::help_first, task_priority(n - 2), [=]{ return fib(n - 2); });
+      int y = th_hf.join();
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int r = root_exec(fib, 15);
+    ITYR_CHECK(r == 987);
+  }
+
+  fini();
+  sched_steal_priority_samples_option::unset();
+}
+
+ITYR_TEST_CASE("[ityr::ito] help-first fib") {
+  init();
+
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      thread<int> th(fork_policy::help_first, [=]{ return fib(n - 1); });
+      int y = fib(n - 2);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int r = root_exec(fib, 15);
+    ITYR_CHECK(r == 987);
+  }
+
+  fini();
+}
+
+ITYR_TEST_CASE("[ityr::ito] future fib") {
+  init();
+
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      future<int> f = async([=]{ return fib(n - 1); });
+      int y = fib(n - 2);
+      int x = f.get();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int r = root_exec(fib, 15);
+    ITYR_CHECK(r == 987);
+  }
+
+  fini();
+}
+
+ITYR_TEST_CASE("[ityr::ito] future with multiple waiters") {
+  init();
+
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      thread<int> th([=]{ return fib(n - 1); });
+      int y = fib(n - 2);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  // Futures are passed to threads not created by the producer and waited for by all of them
+  std::function<int(future<int>, int)> wait_all = [&](future<int> f, int n) -> int {
+    if (n == 1) {
+      ITYR_CHECK(f.get() == 987);
+      return f.get();
+    } else {
+      thread<int> th([=]{ return wait_all(f, n / 2); });
+      int y = wait_all(f, n - n / 2);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int r = root_exec([&] {
+      // The producer is slow so that the waiters are likely to be suspended
+      future<int> f = async([&] {
+        auto t0 = common::clock_gettime_ns();
+        while (common::clock_gettime_ns() - t0 < 10000000) {
+          common::mpi_make_progress();
+        }
+        return fib(15);
+      });
+      future<void> g = async([=] { ITYR_CHECK(f.get() == 987); });
+      int s = wait_all(f, 16);
+      g.get();
+      ITYR_CHECK(f.ready());
+      ITYR_CHECK(g.ready());
+      return s;
+    });
+    ITYR_CHECK(r == 987 * 16);
+  }
+
+  fini();
+}
+
+ITYR_TEST_CASE("[ityr::ito] cancellation") {
+  init();
+
+  constexpr std::size_t n = 1 << 12;
+  constexpr std::size_t target = n / 4;
+
+  struct result {
+    std::size_t pos;
+    std::size_t n_visited;
+  };
+
+  // Search for the first position satisfying `x >= target`; tasks after a found position are
+  // cancelled and return without visiting their leaves
+  std::function<result(cancel_handler, std::size_t, std::size_t)> search =
+      [&](cancel_handler ch, std::size_t b, std::size_t e) -> result {
+    if (is_cancelled(ch, b)) {
+      return {n, 0};
+    }
+    if (e - b == 1) {
+      if (b >= target) {
+        cancel(ch, b + 1);
+        return {b, 1};
+      }
+      return {n, 1};
+    }
+    std::size_t m = b + (e - b) / 2;
+    thread<result> th([=] { return search(ch, b, m); });
+    result r2 = search(ch, m, e);
+    result r1 = th.join();
+    return {std::min(r1.pos, r2.pos), r1.n_visited + r2.n_visited};
+  };
+
+  for (int i = 0; i < 3; i++) {
+    result r = root_exec([=] {
+      cancel_handler ch = cancel_scope_begin();
+      result r = search(ch, 0, n);
+      ITYR_CHECK(is_cancelled(ch));
+      cancel_scope_end(ch);
+      return r;
+    });
+    ITYR_CHECK(r.pos == target);
+    ITYR_CHECK(r.n_visited < n);
+  }
+
+  root_exec([=] {
+    cancel_handler ch = cancel_scope_begin();
+    ITYR_CHECK(!is_cancelled(ch));
+    cancel(ch);
+    ITYR_CHECK(is_cancelled(ch, 0));
+    cancel_scope_end(ch);
+  });
+
+  fini();
+}
+
 ITYR_TEST_CASE("[ityr::ito] load balancing") {
   init();
 
@@ -192,6 +471,31 @@ ITYR_TEST_CASE("[ityr::ito] load balancing") {
   fini();
 }
 
+ITYR_TEST_CASE("[ityr::ito] non-blocking coll_exec()") {
+  init();
+
+  root_exec([] {
+    auto my_rank = common::topology::my_rank();
+    auto n_ranks = common::topology::n_ranks();
+
+    for (int i = 0; i < 10; i++) {
+      auto h = coll_exec_nb([=] {
+        return common::topology::my_rank() == my_rank ? i : -1;
+      });
+      ITYR_CHECK(h.valid());
+      ITYR_CHECK(h.wait() == i);
+      ITYR_CHECK(!h.valid());
+
+      auto ret = coll_exec([=] {
+        return common::mpi_reduce_value(i, my_rank, common::topology::mpicomm());
+      });
+      ITYR_CHECK(ret == i * n_ranks);
+    }
+  });
+
+  fini();
+}
+
 ITYR_TEST_CASE("[ityr::ito] move semantics") {
   init();
 
@@ -251,6 +555,71 @@ ITYR_TEST_CASE("[ityr::ito] nested root/coll_exec()") {
   fini();
 }
 
+ITYR_TEST_CASE("[ityr::ito] root_exec_each") {
+  init();
+
+  std::function<int(int)> fib = [&](int n) -> int {
+    if (n <= 1) {
+      return 1;
+    } else {
+      thread<int> th(fib, n - 1);
+      int y = fib(n - 2);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  auto my_rank = common::topology::my_rank();
+  auto n_ranks = common::topology::n_ranks();
+
+  for (int i = 0; i < 3; i++) {
+    // Root threads of different sizes are completed at different times
+    int n = 10 + (my_rank + i) % 6;
+    int r = root_exec_each([&, n] {
+      ITYR_CHECK(is_root());
+      ITYR_CHECK(!is_spmd());
+
+      future<int> f = async(fib, n);
+      int x = fib(n);
+
+      migrate_to((common::topology::my_rank() + 1) % n_ranks);
+
+      return x + f.get();
+    });
+
+    int a = 1, b = 1;
+    for (int j = 1; j < n; j++) {
+      b = std::exchange(a, a + b);
+    }
+    ITYR_CHECK(r == 2 * a);
+  }
+
+  fini();
+}
+
+ITYR_TEST_CASE("[ityr::ito] stack high-water mark") {
+  init();
+
+  constexpr std::size_t n = 256 * 1024;
+
+  root_exec([=] {
+    std::byte* buf = reinterpret_cast<std::byte*>(alloca(n));
+    std::memset(buf, 1, n);
+    ITYR_CHECK(buf[n / 2] == std::byte(1));
+  });
+
+  if constexpr (!std::is_same_v<scheduler, scheduler_serial>) {
+    std::size_t hwm = stack_high_water_mark();
+    ITYR_CHECK(hwm <= stack_size_option::value());
+    if (common::topology::my_rank() == 0) {
+      // The root thread, which is not migrated, is started by process 0
+      ITYR_CHECK(hwm >= n);
+    }
+  }
+
+  fini();
+}
+
 ITYR_TEST_CASE("[ityr::ito] migrate_to") {
   init();
 
@@ -265,4 +634,37 @@ ITYR_TEST_CASE("[ityr::ito] migrate_to") {
   fini();
 }
 
+ITYR_TEST_CASE("[ityr::ito] migrate_to from non-root threads") {
+  init();
+
+  auto n_ranks = common::topology::n_ranks();
+
+  std::function<int(int, int)> f = [&](int b, int e) -> int {
+    if (e - b == 1) {
+      auto target_rank = b % n_ranks;
+      migrate_to(target_rank);
+      ITYR_CHECK(common::topology::my_rank() == target_rank);
+      return 1;
+    } else {
+      int m = (b + e) / 2;
+      thread<int> th([=]{ return f(b, m); });
+      int y = f(m, e);
+      // migrate between fork and join
+      auto target_rank = m % n_ranks;
+      migrate_to(target_rank);
+      ITYR_CHECK(common::topology::my_rank() == target_rank);
+      int x = th.join();
+      return x + y;
+    }
+  };
+
+  for (int i = 0; i < 3; i++) {
+    int n = 100;
+    int r = root_exec(f, 0, n);
+    ITYR_CHECK(r == n);
+  }
+
+  fini();
+}
+
 }
@@ -23,6 +23,12 @@ struct stack_size_option : public common::option<stack_size_option, std::size_t>
   static std::size_t default_value() { return std::size_t(2) * 1024 * 1024; }
 };
 
+struct stack_guard_size_option : public common::option<stack_guard_size_option, std::size_t> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_STACK_GUARD_SIZE"; }
+  static std::size_t default_value() { return std::size_t(64) * 1024; }
+};
+
 struct wsqueue_capacity_option : public common::option<wsqueue_capacity_option, std::size_t> {
   using option::option;
   static std::string name() { return "ITYR_ITO_WSQUEUE_CAPACITY"; }
@@ -47,6 +53,36 @@ struct sched_loop_make_mpi_progress_option : public common::option<sched_loop_ma
   static bool default_value() { return true; }
 };
 
+struct sched_steal_backoff_option : public common::option<sched_steal_backoff_option, bool> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_SCHED_STEAL_BACKOFF"; }
+  static bool default_value() { return false; }
+};
+
+struct sched_steal_backoff_min_ns_option : public common::option<sched_steal_backoff_min_ns_option, std::size_t> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_SCHED_STEAL_BACKOFF_MIN_NS"; }
+  static std::size_t default_value() { return 1000; }
+};
+
+struct sched_steal_backoff_max_ns_option : public common::option<sched_steal_backoff_max_ns_option, std::size_t> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_SCHED_STEAL_BACKOFF_MAX_NS"; }
+  static std::size_t default_value() { return 100000; }
+};
+
+struct sched_steal_hint_option : public common::option<sched_steal_hint_option, bool> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_SCHED_STEAL_HINT"; }
+  static bool default_value() { return false; }
+};
+
+struct sched_steal_priority_samples_option : public common::option<sched_steal_priority_samples_option, int> {
+  using option::option;
+  static std::string name() { return "ITYR_ITO_SCHED_STEAL_PRIORITY_SAMPLES"; }
+  static int default_value() { return 1; }
+};
+
 struct adws_enable_steal_option : public common::option<adws_enable_steal_option, bool> {
   using option::option;
   static std::string name() { return "ITYR_ITO_ADWS_ENABLE_STEAL"; }
@@ -79,10 +115,16 @@ struct adws_min_drange_size_option : public common::option<adws_min_drange_size_
 
 struct runtime_options {
   common::option_initializer<stack_size_option>                      ITYR_ANON_VAR;
+  common::option_initializer<stack_guard_size_option>                ITYR_ANON_VAR;
   common::option_initializer<wsqueue_capacity_option>                ITYR_ANON_VAR;
   common::option_initializer<thread_state_allocator_size_option>     ITYR_ANON_VAR;
   common::option_initializer<suspended_thread_allocator_size_option> ITYR_ANON_VAR;
   common::option_initializer<sched_loop_make_mpi_progress_option>    ITYR_ANON_VAR;
+  common::option_initializer<sched_steal_backoff_option>             ITYR_ANON_VAR;
+  common::option_initializer<sched_steal_backoff_min_ns_option>      ITYR_ANON_VAR;
+  common::option_initializer<sched_steal_backoff_max_ns_option>      ITYR_ANON_VAR;
+  common::option_initializer<sched_steal_hint_option>                ITYR_ANON_VAR;
+  common::option_initializer<sched_steal_priority_samples_option>    ITYR_ANON_VAR;
   common::option_initializer<adws_enable_steal_option>               ITYR_ANON_VAR;
   common::option_initializer<adws_wsqueue_capacity_option>           ITYR_ANON_VAR;
   common::option_initializer<adws_max_depth_option>                  ITYR_ANON_VAR;
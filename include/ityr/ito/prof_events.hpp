@@ -87,6 +87,11 @@ private:
   bool                           success_mode_;
 };
 
+struct prof_event_sched_steal_backoff : public common::profiler::event {
+  using event::event;
+  std::string str() const override { return "sched_steal_backoff"; }
+};
+
 struct prof_event_sched_mailbox_put : public common::prof_event_target_base {
   using prof_event_target_base::prof_event_target_base;
   std::string str() const override { return "sched_mailbox_put"; }
@@ -223,6 +228,7 @@ public:
 
 private:
   common::profiler::event_initializer<prof_event_sched_steal>          ITYR_ANON_VAR;
+  common::profiler::event_initializer<prof_event_sched_steal_backoff>  ITYR_ANON_VAR;
   common::profiler::event_initializer<prof_event_sched_mailbox_put>    ITYR_ANON_VAR;
   common::profiler::event_initializer<prof_event_sched_adws_scan_tree> ITYR_ANON_VAR;
   common::profiler::event_initializer<prof_event_wsqueue_push>         ITYR_ANON_VAR;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "ityr/common/util.hpp"
 #include "ityr/common/mpi_util.hpp"
 #include "ityr/common/mpi_rma.hpp"
@@ -301,7 +303,7 @@ public:
 
   scheduler_adws()
     : max_depth_(adws_max_depth_option::value()),
-      stack_(stack_size_option::value()),
+      stack_(stack_size_option::value(), stack_guard_size_option::value()),
       // Add a margin of sizeof(context_frame) to the bottom of the stack, because
       // this region can be accessed by the clear_parent_frame() function later.
       // This stack base is updated only in coll_exec().
@@ -373,6 +375,24 @@ public:
     return retval.value;
   }
 
+  // The work of a root thread is distributed over all processes according to work hints,
+  // and thus the root threads started by the processes are executed one by one.
+  template <typename T, typename SchedLoopCallback, typename Fn, typename... Args>
+  T root_exec_each(SchedLoopCallback cb, Fn&& fn, Args&&... args) {
+    std::optional<T> ret;
+    for (common::topology::rank_t r = 0; r < common::topology::n_ranks(); r++) {
+      if (r == common::topology::my_rank()) {
+        ret.emplace(root_exec<T>(cb, std::forward<Fn>(fn), std::forward<Args>(args)...));
+      } else {
+        common::profiler::switch_phase<prof_phase_spmd, prof_phase_sched_loop>();
+        sched_loop(cb);
+        common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_spmd>();
+      }
+      common::mpi_barrier(common::topology::mpicomm());
+    }
+    return std::move(*ret);
+  }
+
   void task_group_begin(task_group_data* tgdata) {
     tls_->dag_prof.stop();
 
@@ -447,11 +467,12 @@ public:
     tls_->dag_prof.increment_strand_count();
   }
 
+  // Task priorities are ignored, as work is distributed according to work hints
   template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
             typename WorkHint, typename Fn, typename... Args>
   void fork(thread_handler<T>& th,
             OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
-            WorkHint w_new, WorkHint w_rest, Fn&& fn, Args&&... args) {
+            WorkHint w_new, WorkHint w_rest, int, Fn&& fn, Args&&... args) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_fork>();
 
     auto my_rank = common::topology::my_rank();
@@ -617,6 +638,70 @@ public:
     tls_->dag_prof.increment_strand_count();
   }
 
+  // Help-first forking is not supported; fall back to work-first forking
+  template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename WorkHint, typename Fn, typename... Args>
+  void fork_help_first(thread_handler<T>& th,
+                       OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
+                       WorkHint w_new, WorkHint w_rest, int priority, Fn&& fn, Args&&... args) {
+    fork(th, on_drift_fork_cb, on_drift_die_cb, w_new, w_rest, priority,
+         std::forward<Fn>(fn), std::forward<Args>(args)...);
+  }
+
+  // Futures are not supported; async tasks are executed eagerly when they are created
+  template <typename T>
+  using future_handler = T;
+
+  template <typename T, typename OnDriftForkCallback, typename OnDieCallback,
+            typename Fn, typename... Args>
+  void async(future_handler<T>& fh,
+             OnDriftForkCallback, OnDieCallback,
+             Fn&& fn, Args&&... args) {
+    fh = invoke_fn<T>(std::forward<Fn>(fn), std::make_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename T>
+  bool future_ready(const future_handler<T>&) const {
+    return true;
+  }
+
+  template <typename T>
+  T future_get(const future_handler<T>& fh) {
+    return fh;
+  }
+
+  template <typename T>
+  void future_retain(const future_handler<T>&) {}
+
+  template <typename T>
+  void future_release(const future_handler<T>&) {}
+
+  // Cooperative cancellation: tasks are associated with positions (e.g., the beginning of their
+  // ranges), and a cancel word visible to all processes holds the lowest cancelled position
+  using cancel_handler = std::size_t*;
+
+  cancel_handler cancel_scope_begin() {
+    return new (thread_state_allocator_.allocate(sizeof(std::size_t)))
+      std::size_t(std::numeric_limits<std::size_t>::max());
+  }
+
+  void cancel_scope_end(cancel_handler ch) {
+    thread_state_allocator_.deallocate(ch, sizeof(std::size_t));
+  }
+
+  void cancel(cancel_handler ch, std::size_t pos) {
+    std::size_t v = remote_get_value(thread_state_allocator_, ch);
+    while (pos < v) {
+      std::size_t prev = remote_cas_value(thread_state_allocator_, pos, v, ch);
+      if (prev == v) break;
+      v = prev;
+    }
+  }
+
+  bool is_cancelled(cancel_handler ch, std::size_t pos) const {
+    return remote_get_value(thread_state_allocator_, ch) <= pos;
+  }
+
   template <typename T>
   T join(thread_handler<T>& th) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_join>();
@@ -756,12 +841,18 @@ public:
     suspend([&](context_frame* cf) {
       suspended_state ss = evacuate(cf);
 
-      common::verbose("Migrate continuation of cross-worker-task [%f, %f) to process %d",
-                      tls_->drange.begin(), tls_->drange.end(), target_rank);
+      // `tls_` is null if a root thread started by a process other than 0 is migrated to
+      // process 0 before it begins (see root_exec())
+      if (tls_) {
+        common::verbose("Migrate continuation of cross-worker-task [%f, %f) to process %d",
+                        tls_->drange.begin(), tls_->drange.end(), target_rank);
+      }
 
       migration_mailbox_.put(ss, target_rank);
 
-      evacuate_all();
+      if (tls_) {
+        evacuate_all();
+      }
       common::profiler::switch_phase<prof_phase_sched_migrate, prof_phase_sched_loop>();
       resume_sched();
     });
@@ -772,8 +863,22 @@ public:
         std::forward<PostSuspendCallback>(post_suspend_cb), cb_ret);
   }
 
+  struct coll_task_handle {
+    task_general*            task        = nullptr;
+    std::size_t              task_size   = 0;
+    common::topology::rank_t master_rank = 0;
+    int                      n_children  = 0;
+  };
+
   template <typename Fn>
   void coll_exec(const Fn& fn) {
+    coll_exec_wait(coll_exec_nb(fn));
+  }
+
+  // Execute the coll task on this (master) process and return without waiting for
+  // the completion on the other processes; `coll_exec_wait()` must be called later.
+  template <typename Fn>
+  coll_task_handle coll_exec_nb(const Fn& fn) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_spmd>();
 
     tls_->dag_prof.stop();
@@ -787,20 +892,44 @@ public:
     auto t = new (task_ptr) callable_task_t(fn);
 
     coll_task ct {task_ptr, task_size, common::topology::my_rank()};
-    execute_coll_task(t, ct);
-
-    suspended_thread_allocator_.deallocate(t, task_size);
+    int n_children = execute_coll_task(t, ct);
 
     tls_->dag_prof.start();
     tls_->dag_prof.increment_strand_count();
 
     common::profiler::switch_phase<prof_phase_spmd, prof_phase_thread>();
+
+    return {t, task_size, ct.master_rank, n_children};
+  }
+
+  void coll_exec_wait(const coll_task_handle& h) {
+    ITYR_CHECK(h.task);
+
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_spmd>();
+
+    // The completion of all processes is notified through the tree; it also ensures that
+    // no process is still reading the task object before deallocation.
+    coll_task_done_.wait(h.n_children, h.master_rank);
+
+    // The task object may be remote if this thread has been migrated in the meantime
+    suspended_thread_allocator_.deallocate(h.task, h.task_size);
+
+    common::profiler::switch_phase<prof_phase_spmd, prof_phase_thread>();
   }
 
   bool is_executing_root() const {
     return cf_top_ && cf_top_ == stack_base_;
   }
 
+  std::size_t stack_high_water_mark() const {
+    return stack_.high_water_mark();
+  }
+
+  // Loops are always split in ADWS so that work is distributed according to work hints
+  bool should_split() const {
+    return true;
+  }
+
   template <typename T>
   static bool is_serialized(const thread_handler<T>& th) {
     return th.serialized;
@@ -1466,42 +1595,45 @@ private:
     }, &fn, nullptr, nullptr, nullptr);
   }
 
-  void execute_coll_task(task_general* t, coll_task ct) {
+  int execute_coll_task(task_general* t, coll_task ct) {
     // TODO: consider copy semantics for tasks
     coll_task ct_ {t, ct.task_size, ct.master_rank};
 
     // pass coll task to other processes in a binary tree form
-    auto n_ranks = common::topology::n_ranks();
-    auto my_rank = common::topology::my_rank();
-    auto my_rank_shifted = (my_rank + n_ranks - ct.master_rank) % n_ranks;
-    for (common::topology::rank_t i = common::next_pow2(n_ranks); i > 1; i /= 2) {
-      if (my_rank_shifted % i == 0) {
-        auto target_rank_shifted = my_rank_shifted + i / 2;
-        if (target_rank_shifted < n_ranks) {
-          auto target_rank = (target_rank_shifted + ct.master_rank) % n_ranks;
-          coll_task_mailbox_.put(ct_, target_rank);
-        }
-      }
-    }
+    int n_children = 0;
+    for_each_coll_tree_child(ct.master_rank, [&](common::topology::rank_t target_rank) {
+      coll_task_mailbox_.put(ct_, target_rank);
+      n_children++;
+    });
 
+    // Allocate half the rest of the stack space for nested root/coll_exec().
+    // Because the current stack base is identical on all processes, every process can compute
+    // the next stack base without communication.
     auto prev_stack_base = stack_base_;
-    if (my_rank == ct.master_rank) {
-      // Allocate half the rest of the stack space for nested root/coll_exec()
-      stack_base_ = cf_top_ - (cf_top_ - reinterpret_cast<context_frame*>(stack_.top())) / 2;
+    stack_base_ = stack_base_ - (stack_base_ - reinterpret_cast<context_frame*>(stack_.top())) / 2;
+
+    if (common::topology::my_rank() == ct.master_rank) {
+      // The stack frames of the master worker running this coll task are in the RDMA-capable
+      // stack region, which must not overlap with those of nested root_exec() calls
+      if (reinterpret_cast<std::byte*>(__builtin_frame_address(0)) <=
+          reinterpret_cast<std::byte*>(stack_base_)) {
+        common::die("[ityr::ito::scheduler] The call stack is too deep to call coll_exec(); "
+                    "try a larger stack size (ITYR_ITO_STACK_SIZE)");
+      }
     }
 
-    // Ensure all processes have finished coll task execution before deallocation.
-    // In addition, collectively set the next stack base for nested root_exec() calls because
-    // the stack frame of the scheduler of the master worker is in the RDMA-capable stack region.
-    // TODO: check if the scheduler's stack frame and nested root_exec()'s stack frame do not overlap
-    stack_base_ = common::mpi_bcast_value(stack_base_, ct.master_rank, common::topology::mpicomm());
-
     t->execute();
 
     stack_base_ = prev_stack_base;
 
-    // Ensure all processes have finished coll task execution before deallocation
-    common::mpi_barrier(common::topology::mpicomm());
+    return n_children;
+  }
+
+  void wait_coll_task_children(const coll_task& ct, int n_children) {
+    coll_task_done_.wait(n_children, common::topology::my_rank());
+
+    // Notify the parent after all descendants have completed
+    coll_task_done_.put(coll_tree_parent(ct.master_rank));
   }
 
   void execute_coll_task_if_arrived() {
@@ -1517,7 +1649,9 @@ private:
 
       common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_spmd>();
 
-      execute_coll_task(t, *ct);
+      int n_children = execute_coll_task(t, *ct);
+
+      wait_coll_task_children(*ct, n_children);
 
       common::profiler::switch_phase<prof_phase_spmd, prof_phase_sched_loop>();
 
@@ -1577,6 +1711,7 @@ private:
   context_frame*                     stack_base_;
   oneslot_mailbox<void>              exit_request_mailbox_;
   oneslot_mailbox<coll_task>         coll_task_mailbox_;
+  arrival_counter                    coll_task_done_;
   oneslot_mailbox<suspended_state>   migration_mailbox_;
   wsqueue<primary_wsq_entry, false>  primary_wsq_;
   wsqueue<migration_wsq_entry, true> migration_wsq_;
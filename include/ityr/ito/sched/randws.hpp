@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <deque>
 #include "ityr/common/allocator.hpp"
 #include "ityr/common/logger.hpp"
 #include "ityr/common/mpi_rma.hpp"
@@ -43,16 +44,43 @@ public:
   struct thread_state {
     thread_retval<T> retval;
     int              resume_flag = 0;
+    uint64_t         join_word   = 0; // used instead of `retval` and `resume_flag` if packed
     suspended_state  suspended;
   };
 
+  // A small return value is packed together with the join state into a single word, so that
+  // a stolen join is completed with a single atomic operation by each of the joining thread and
+  // the joined thread, and the return value needs no separate put/get
+  template <typename T>
+  static constexpr bool is_retval_packed_v = std::is_trivially_copyable_v<T> &&
+                                             sizeof(T) <= sizeof(uint32_t) &&
+                                             !dag_profiler::enabled;
+
+  // A child task forked with the help-first policy, which is pushed to the task queue as a closure
+  // and is either executed inline at join or copied by value to a thief to start a new thread
+  template <typename T>
+  class help_first_task;
+
   template <typename T>
   struct thread_handler {
-    thread_state<T>* state      = nullptr;
-    bool             serialized = false;
-    thread_retval<T> retval_ser; // return the result by value if the thread is serialized
+    thread_state<T>*    state        = nullptr;
+    bool                serialized   = false;
+    thread_retval<T>    retval_ser; // return the result by value if the thread is serialized
+    help_first_task<T>* hf_task      = nullptr; // not null until a help-first child is joined
+    std::size_t         hf_task_size = 0;
   };
 
+  // Shared state of a future, which can be waited for by any number of threads
+  template <typename T>
+  struct future_state {
+    thread_retval<T> retval;
+    uintptr_t        waiters  = 0; // list of suspended waiters; `future_completed` once completed
+    int              refcount = 2; // the producer thread and the first handle
+  };
+
+  template <typename T>
+  using future_handler = future_state<T>*;
+
   struct task_group_data {
     task_group_data* parent = nullptr;
     dag_profiler     dag_prof_before;
@@ -60,16 +88,18 @@ public:
   };
 
   struct thread_local_storage {
-    task_group_data* tgdata = nullptr;
+    task_group_data* tgdata   = nullptr;
+    int              priority = 0;
     dag_profiler     dag_prof;
   };
 
   scheduler_randws()
-    : stack_(stack_size_option::value()),
+    : stack_(stack_size_option::value(), stack_guard_size_option::value()),
       // Add a margin of sizeof(context_frame) to the bottom of the stack, because
       // this region can be accessed by the clear_parent_frame() function later.
       // This stack base is updated only in coll_exec().
       stack_base_(reinterpret_cast<context_frame*>(stack_.bottom()) - 1),
+      migration_mailbox_(thread_state_allocator_),
       wsq_(wsqueue_capacity_option::value()),
       thread_state_allocator_(thread_state_allocator_size_option::value()),
       suspended_thread_allocator_(suspended_thread_allocator_size_option::value()) {}
@@ -131,11 +161,23 @@ public:
     return std::move(retval.value);
   }
 
+  // Every process starts its own root thread, which is executed concurrently with those started
+  // by the other processes. Root threads are independent of each other, but they share the workers
+  // and their tasks can be stolen by any process. This returns the result of the root thread
+  // started by the calling process, after all root threads are completed.
+  template <typename T, typename SchedLoopCallback, typename Fn, typename... Args>
+  T root_exec_each(SchedLoopCallback cb, Fn&& fn, Args&&... args) {
+    n_roots_ = common::topology::n_ranks();
+    T ret = root_exec<T>(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    n_roots_ = 1;
+    return ret;
+  }
+
   template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
             typename WorkHint, typename Fn, typename... Args>
   void fork(thread_handler<T>& th,
             OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
-            WorkHint, WorkHint, Fn&& fn, Args&&... args) {
+            WorkHint, WorkHint, int priority, Fn&& fn, Args&&... args) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_fork>();
 
     thread_state<T>* ts = new (thread_state_allocator_.allocate(sizeof(thread_state<T>))) thread_state<T>;
@@ -146,10 +188,15 @@ public:
              args_tuple = std::make_tuple(std::forward<Args>(args)...)](context_frame* cf) mutable {
       common::verbose<2>("push context frame [%p, %p) into task queue", cf, cf->parent_frame);
 
+      // The continuation keeps the priority of the parent
+      int parent_priority = tls_->priority;
+
       tls_ = new (alloca(sizeof(thread_local_storage))) thread_local_storage{};
+      tls_->priority = (priority == task_priority::inherit) ? parent_priority : priority;
 
       std::size_t cf_size = reinterpret_cast<uintptr_t>(cf->parent_frame) - reinterpret_cast<uintptr_t>(cf);
-      wsq_.push(wsqueue_entry{cf, cf_size});
+      wsq_.push(wsqueue_entry{cf, cf_size, false, parent_priority});
+      steal_hint_.notify();
 
       tls_->dag_prof.start();
       tls_->dag_prof.increment_thread_count();
@@ -169,8 +216,11 @@ public:
 
       common::verbose<2>("Thread %p is serialized (fast path)", ts);
 
-      // The following is executed only when the thread is serialized
-      std::destroy_at(ts);
+      // The following is executed only when the thread is serialized.
+      // The thread state can be remote if this thread has waited for a future.
+      if (thread_state_allocator_.is_locally_accessible(ts)) {
+        std::destroy_at(ts);
+      }
       thread_state_allocator_.deallocate(ts, sizeof(thread_state<T>));
       th.state      = nullptr;
       th.serialized = true;
@@ -195,12 +245,47 @@ public:
     tls_->dag_prof.increment_strand_count();
   }
 
+  template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename WorkHint, typename Fn, typename... Args>
+  void fork_help_first(thread_handler<T>& th,
+                       OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
+                       WorkHint, WorkHint, int priority, Fn&& fn, Args&&... args) {
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_fork>();
+
+    thread_state<T>* ts = new (thread_state_allocator_.allocate(sizeof(thread_state<T>))) thread_state<T>;
+
+    using task_t = help_first_callable_task<T, OnDriftForkCallback, OnDriftDieCallback,
+                                           std::decay_t<Fn>, std::tuple<std::decay_t<Args>...>>;
+
+    int child_priority = (priority == task_priority::inherit) ? tls_->priority : priority;
+
+    std::size_t task_size = sizeof(task_t);
+    auto t = new (suspended_thread_allocator_.allocate(task_size))
+      task_t(ts, child_priority, on_drift_fork_cb, on_drift_die_cb,
+             std::forward<Fn>(fn), std::make_tuple(std::forward<Args>(args)...));
+
+    th.state        = ts;
+    th.serialized   = false;
+    th.hf_task      = t;
+    th.hf_task_size = task_size;
+
+    common::verbose<2>("push help-first task %p into task queue", t);
+
+    wsq_.push(wsqueue_entry{static_cast<help_first_task_base*>(t), task_size, true, child_priority});
+    steal_hint_.notify();
+
+    common::profiler::switch_phase<prof_phase_sched_fork, prof_phase_thread>();
+  }
+
   template <typename T>
   T join(thread_handler<T>& th) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_join>();
 
     thread_retval<T> retval;
-    if (th.serialized) {
+    if (th.hf_task && execute_help_first_task_inline(th, retval)) {
+      common::verbose<2>("Help-first task was executed inline (fast path)");
+
+    } else if (th.serialized) {
       common::verbose<2>("Skip join for serialized thread (fast path)");
       // We can skip deallocaton for its thread state because it has been already deallocated
       // when the thread is serialized (i.e., at a fork)
@@ -212,7 +297,10 @@ public:
       ITYR_CHECK(th.state != nullptr);
       thread_state<T>* ts = th.state;
 
-      if (remote_get_value(thread_state_allocator_, &ts->resume_flag) >= 1) {
+      if constexpr (is_retval_packed_v<T>) {
+        retval = join_packed(ts);
+
+      } else if (remote_get_value(thread_state_allocator_, &ts->resume_flag) >= 1) {
         common::verbose("Thread %p is already joined", ts);
         if constexpr (!std::is_same_v<T, no_retval_t> || dag_profiler::enabled) {
           retval = get_retval_remote(ts);
@@ -263,11 +351,146 @@ public:
     return std::move(retval.value);
   }
 
+  template <typename T, typename OnDriftForkCallback, typename OnDieCallback,
+            typename Fn, typename... Args>
+  void async(future_handler<T>& fh,
+             OnDriftForkCallback on_drift_fork_cb, OnDieCallback on_die_cb,
+             Fn&& fn, Args&&... args) {
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_fork>();
+
+    future_state<T>* fs = new (thread_state_allocator_.allocate(sizeof(future_state<T>))) future_state<T>;
+    fh = fs;
+
+    bool serialized = false;
+
+    suspend([&, fs, fn = std::forward<Fn>(fn),
+             args_tuple = std::make_tuple(std::forward<Args>(args)...)](context_frame* cf) mutable {
+      common::verbose<2>("push context frame [%p, %p) into task queue", cf, cf->parent_frame);
+
+      int priority = tls_->priority;
+
+      tls_ = new (alloca(sizeof(thread_local_storage))) thread_local_storage{};
+      tls_->priority = priority;
+
+      std::size_t cf_size = reinterpret_cast<uintptr_t>(cf->parent_frame) - reinterpret_cast<uintptr_t>(cf);
+      wsq_.push(wsqueue_entry{cf, cf_size, false, priority});
+      steal_hint_.notify();
+
+      tls_->dag_prof.start();
+      tls_->dag_prof.increment_thread_count();
+      tls_->dag_prof.increment_strand_count();
+
+      common::verbose<2>("Starting new async thread %p", fs);
+      common::profiler::switch_phase<prof_phase_sched_fork, prof_phase_thread>();
+
+      T&& ret = invoke_fn<T>(std::forward<decltype(fn)>(fn), std::forward<decltype(args_tuple)>(args_tuple));
+
+      common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_die>();
+      common::verbose<2>("Async thread %p is completed", fs);
+
+      on_task_die();
+
+      // Waiters can be on any process, so the callback is called even if not drifted
+      call_with_prof_events<prof_phase_sched_die,
+                            prof_phase_cb_drift_die,
+                            prof_phase_sched_die>(on_die_cb);
+
+      // The parent is not blocked by this thread; resume it if it is still in the local queue
+      auto qe = wsq_.pop();
+
+      complete_future(fs, std::move(ret));
+
+      if (!qe.has_value()) {
+        common::profiler::switch_phase<prof_phase_sched_die, prof_phase_sched_loop>();
+        resume_sched();
+      }
+
+      serialized = true;
+
+      common::profiler::switch_phase<prof_phase_sched_die, prof_phase_sched_resume_popped>();
+    });
+
+    if (serialized) {
+      common::profiler::switch_phase<prof_phase_sched_resume_popped, prof_phase_thread>();
+    } else {
+      call_with_prof_events<prof_phase_sched_resume_stolen,
+                            prof_phase_cb_drift_fork,
+                            prof_phase_thread>(on_drift_fork_cb);
+    }
+  }
+
+  template <typename T>
+  bool future_ready(future_handler<T> fs) const {
+    return remote_get_value(thread_state_allocator_, &fs->waiters) == future_completed;
+  }
+
+  template <typename T>
+  T future_get(future_handler<T> fs) {
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_join>();
+
+    if (!future_ready(fs)) {
+      wait_future(&fs->waiters);
+    }
+
+    thread_retval<T> retval;
+    if constexpr (!std::is_same_v<T, no_retval_t>) {
+      retval = get_retval_remote(fs);
+    }
+
+    common::profiler::switch_phase<prof_phase_sched_join, prof_phase_thread>();
+    return std::move(retval.value);
+  }
+
+  template <typename T>
+  void future_retain(future_handler<T> fs) {
+    remote_faa_value(thread_state_allocator_, 1, &fs->refcount);
+  }
+
+  template <typename T>
+  void future_release(future_handler<T> fs) {
+    if (remote_faa_value(thread_state_allocator_, -1, &fs->refcount) == 1) {
+      thread_state_allocator_.deallocate(fs, sizeof(future_state<T>));
+    }
+  }
+
+  // Cooperative cancellation: tasks are associated with positions (e.g., the beginning of their
+  // ranges), and a cancel word visible to all processes holds the lowest cancelled position
+  using cancel_handler = std::size_t*;
+
+  cancel_handler cancel_scope_begin() {
+    return new (thread_state_allocator_.allocate(sizeof(std::size_t)))
+      std::size_t(std::numeric_limits<std::size_t>::max());
+  }
+
+  void cancel_scope_end(cancel_handler ch) {
+    thread_state_allocator_.deallocate(ch, sizeof(std::size_t));
+  }
+
+  void cancel(cancel_handler ch, std::size_t pos) {
+    std::size_t v = remote_get_value(thread_state_allocator_, ch);
+    while (pos < v) {
+      std::size_t prev = remote_cas_value(thread_state_allocator_, pos, v, ch);
+      if (prev == v) break;
+      v = prev;
+    }
+  }
+
+  bool is_cancelled(cancel_handler ch, std::size_t pos) const {
+    return remote_get_value(thread_state_allocator_, ch) <= pos;
+  }
+
   template <typename SchedLoopCallback>
   void sched_loop(SchedLoopCallback cb) {
     common::verbose("Enter scheduling loop");
 
     while (!should_exit_sched_loop()) {
+      if (!ready_threads_.empty()) {
+        suspended_state ss = ready_threads_.front();
+        ready_threads_.pop_front();
+        execute_ready_thread(ss);
+        continue;
+      }
+
       auto mte = migration_mailbox_.pop();
       if (mte.has_value()) {
         execute_migrated_task(*mte);
@@ -281,6 +504,8 @@ public:
       }
     }
 
+    steal_backoff_.reset();
+
     common::verbose("Exit scheduling loop");
   }
 
@@ -291,9 +516,6 @@ public:
   void migrate_to(common::topology::rank_t target_rank,
                   PreSuspendCallback&&     pre_suspend_cb,
                   PostSuspendCallback&&    post_suspend_cb) {
-    // Currently only for the root thread
-    ITYR_CHECK(is_executing_root());
-
     if (target_rank == common::topology::my_rank()) return;
 
     auto cb_ret = call_with_prof_events<prof_phase_thread,
@@ -301,10 +523,12 @@ public:
                                         prof_phase_sched_migrate>(
         std::forward<PreSuspendCallback>(pre_suspend_cb));
 
+    queued_continuations qc;
+
     suspend([&](context_frame* cf) {
-      suspended_state ss = evacuate(cf);
+      suspended_state ss = evacuate_with_queue(cf, qc);
 
-      common::verbose("Migrate continuation of the root thread to process %d",
+      common::verbose("Migrate continuation of the current thread to process %d",
                       target_rank);
 
       migration_mailbox_.put(ss, target_rank);
@@ -313,14 +537,32 @@ public:
       resume_sched();
     });
 
+    // The local queue of this process is empty here, as migrated threads are received only
+    // in the scheduling loop
+    restore_queue(qc);
+
     call_with_prof_events<prof_phase_sched_resume_migrate,
                           prof_phase_cb_post_suspend,
                           prof_phase_thread>(
         std::forward<PostSuspendCallback>(post_suspend_cb), cb_ret);
   }
 
+  struct coll_task_handle {
+    task_general*            task        = nullptr;
+    std::size_t              task_size   = 0;
+    common::topology::rank_t master_rank = 0;
+    int                      n_children  = 0;
+  };
+
   template <typename Fn>
   void coll_exec(const Fn& fn) {
+    coll_exec_wait(coll_exec_nb(fn));
+  }
+
+  // Execute the coll task on this (master) process and return without waiting for
+  // the completion on the other processes; `coll_exec_wait()` must be called later.
+  template <typename Fn>
+  coll_task_handle coll_exec_nb(const Fn& fn) {
     common::profiler::switch_phase<prof_phase_thread, prof_phase_spmd>();
 
     tls_->dag_prof.stop();
@@ -334,20 +576,45 @@ public:
     auto t = new (task_ptr) callable_task_t(fn);
 
     coll_task ct {task_ptr, task_size, common::topology::my_rank()};
-    execute_coll_task(t, ct);
-
-    suspended_thread_allocator_.deallocate(t, task_size);
+    int n_children = execute_coll_task(t, ct);
 
     tls_->dag_prof.start();
     tls_->dag_prof.increment_strand_count();
 
     common::profiler::switch_phase<prof_phase_spmd, prof_phase_thread>();
+
+    return {t, task_size, ct.master_rank, n_children};
+  }
+
+  void coll_exec_wait(const coll_task_handle& h) {
+    ITYR_CHECK(h.task);
+
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_spmd>();
+
+    // The completion of all processes is notified through the tree; it also ensures that
+    // no process is still reading the task object before deallocation.
+    coll_task_done_.wait(h.n_children, h.master_rank);
+
+    // The task object may be remote if this thread has been migrated in the meantime
+    suspended_thread_allocator_.deallocate(h.task, h.task_size);
+
+    common::profiler::switch_phase<prof_phase_spmd, prof_phase_thread>();
   }
 
   bool is_executing_root() const {
     return cf_top_ && cf_top_ == stack_base_;
   }
 
+  std::size_t stack_high_water_mark() const {
+    return stack_.high_water_mark();
+  }
+
+  // Lazily split loops expose more parallelism only when no stealable task is left locally
+  // or a thief is waiting for this process to have work
+  bool should_split() const {
+    return wsq_.size() == 0 || steal_hint_.has_waiter();
+  }
+
   template <typename T>
   static bool is_serialized(const thread_handler<T>& th) {
     return th.serialized;
@@ -412,7 +679,147 @@ public:
     }
   }
 
+  class help_first_task_base {
+  public:
+    virtual ~help_first_task_base() = default;
+    // Start a new thread for the stolen task; this local copy of the task is freed inside
+    virtual void execute_stolen(scheduler_randws& sched, std::size_t task_size) = 0;
+  };
+
+  template <typename T>
+  class help_first_task : public help_first_task_base {
+  public:
+    // Execute the task in the joining thread; this task is freed before execution because
+    // the joining thread can be migrated to another process during execution
+    virtual T execute_inline(scheduler_randws& sched, std::size_t task_size) = 0;
+  };
+
 private:
+  template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename Fn, typename ArgsTuple>
+  class help_first_callable_task : public help_first_task<T> {
+  public:
+    template <typename Fn_, typename ArgsTuple_>
+    help_first_callable_task(thread_state<T>*    ts,
+                             int                 priority,
+                             OnDriftForkCallback on_drift_fork_cb,
+                             OnDriftDieCallback  on_drift_die_cb,
+                             Fn_&&               fn,
+                             ArgsTuple_&&        args_tuple)
+      : ts_(ts),
+        priority_(priority),
+        on_drift_fork_cb_(on_drift_fork_cb),
+        on_drift_die_cb_(on_drift_die_cb),
+        fn_(std::forward<Fn_>(fn)),
+        args_tuple_(std::forward<ArgsTuple_>(args_tuple)) {}
+
+    T execute_inline(scheduler_randws& sched, std::size_t task_size) override {
+      Fn        fn         = std::move(fn_);
+      ArgsTuple args_tuple = std::move(args_tuple_);
+
+      std::destroy_at(this);
+      sched.suspended_thread_allocator_.deallocate(this, task_size);
+
+      return invoke_fn<T>(std::move(fn), std::move(args_tuple));
+    }
+
+    void execute_stolen(scheduler_randws& sched, std::size_t task_size) override {
+      // Move the closure to the new stack frame before freeing the task
+      thread_state<T>*    ts               = ts_;
+      int                 priority         = priority_;
+      OnDriftForkCallback on_drift_fork_cb = on_drift_fork_cb_;
+      OnDriftDieCallback  on_drift_die_cb  = on_drift_die_cb_;
+      Fn                  fn               = std::move(fn_);
+      ArgsTuple           args_tuple       = std::move(args_tuple_);
+
+      std::destroy_at(this);
+      sched.suspended_thread_allocator_.deallocate(this, task_size);
+
+      sched.run_stolen_help_first_task<T>(ts, priority, on_drift_fork_cb, on_drift_die_cb,
+                                          std::move(fn), std::move(args_tuple));
+    }
+
+  private:
+    thread_state<T>*    ts_;
+    int                 priority_;
+    OnDriftForkCallback on_drift_fork_cb_;
+    OnDriftDieCallback  on_drift_die_cb_;
+    Fn                  fn_;
+    ArgsTuple           args_tuple_;
+  };
+
+  template <typename T>
+  bool execute_help_first_task_inline(thread_handler<T>& th, thread_retval<T>& retval) {
+    help_first_task<T>* t = th.hf_task;
+    th.hf_task = nullptr;
+
+    auto qe = wsq_.pop();
+    if (!qe.has_value()) {
+      // Stolen; the thief has already copied the task while locking the queue
+      suspended_thread_allocator_.deallocate(t, th.hf_task_size);
+      return false;
+    }
+
+    // Help-first children must be joined in the reverse order of forks
+    ITYR_CHECK(qe->help_first);
+    ITYR_CHECK(qe->frame_base == static_cast<help_first_task_base*>(t));
+
+    if (!suspended_thread_allocator_.is_locally_accessible(t)) {
+      // The task was left on another process when this thread waited for a future
+      void* task_ptr = suspended_thread_allocator_.allocate(th.hf_task_size);
+      common::remote_get(suspended_thread_allocator_,
+                         reinterpret_cast<std::byte*>(task_ptr),
+                         reinterpret_cast<std::byte*>(t),
+                         th.hf_task_size);
+      suspended_thread_allocator_.deallocate(t, th.hf_task_size);
+      t = reinterpret_cast<help_first_task<T>*>(task_ptr);
+    }
+
+    if (thread_state_allocator_.is_locally_accessible(th.state)) {
+      std::destroy_at(th.state);
+    }
+    thread_state_allocator_.deallocate(th.state, sizeof(thread_state<T>));
+    th.state      = nullptr;
+    th.serialized = true;
+
+    // Do not touch local resources after execution, as this thread may have been migrated
+    common::profiler::switch_phase<prof_phase_sched_join, prof_phase_thread>();
+    retval = {t->execute_inline(*this, th.hf_task_size), dag_profiler{}};
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_join>();
+
+    return true;
+  }
+
+  template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename Fn, typename ArgsTuple>
+  void run_stolen_help_first_task(thread_state<T>*    ts,
+                                  int                 priority,
+                                  OnDriftForkCallback on_drift_fork_cb,
+                                  OnDriftDieCallback  on_drift_die_cb,
+                                  Fn&&                fn,
+                                  ArgsTuple&&         args_tuple) {
+    tls_ = new (alloca(sizeof(thread_local_storage))) thread_local_storage{};
+    tls_->priority = priority;
+
+    tls_->dag_prof.start();
+    tls_->dag_prof.increment_thread_count();
+    tls_->dag_prof.increment_strand_count();
+
+    common::verbose<2>("Starting new thread %p (help-first)", ts);
+
+    call_with_prof_events<prof_phase_sched_resume_stolen,
+                          prof_phase_cb_drift_fork,
+                          prof_phase_thread>(on_drift_fork_cb);
+
+    T&& ret = invoke_fn<T>(std::forward<Fn>(fn), std::forward<ArgsTuple>(args_tuple));
+
+    common::profiler::switch_phase<prof_phase_thread, prof_phase_sched_die>();
+    common::verbose<2>("Thread %p is completed", ts);
+
+    on_task_die();
+    on_die_drifted(ts, std::move(ret), on_drift_die_cb);
+  }
+
   struct coll_task {
     void*                    task_ptr;
     std::size_t              task_size;
@@ -437,10 +844,20 @@ private:
       return;
     }
 
+    on_die_drifted(ts, std::move(ret), on_drift_die_cb);
+  }
+
+  template <typename T, typename OnDriftDieCallback>
+  void on_die_drifted(thread_state<T>* ts, T&& ret, OnDriftDieCallback on_drift_die_cb) {
     call_with_prof_events<prof_phase_sched_die,
                           prof_phase_cb_drift_die,
                           prof_phase_sched_die>(on_drift_die_cb);
 
+    if constexpr (is_retval_packed_v<T>) {
+      on_die_packed(ts, ret);
+      return;
+    }
+
     if constexpr (!std::is_same_v<T, no_retval_t> || dag_profiler::enabled) {
       put_retval_remote(ts, {std::move(ret), tls_->dag_prof});
     }
@@ -458,6 +875,84 @@ private:
     }
   }
 
+  static constexpr uint64_t join_word_waiting   = 1; // the joining thread is suspended
+  static constexpr uint64_t join_word_completed = 2; // the joined thread is completed
+
+  template <typename T>
+  static uint64_t pack_retval(const T& value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return (uint64_t(bits) << 32) | join_word_completed;
+  }
+
+  template <typename T>
+  static thread_retval<T> unpack_retval(uint64_t w) {
+    ITYR_CHECK(w & join_word_completed);
+    uint32_t bits = w >> 32;
+    thread_retval<T> retval;
+    std::memcpy(&retval.value, &bits, sizeof(T));
+    return retval;
+  }
+
+  template <typename T>
+  thread_retval<T> join_packed(thread_state<T>* ts) {
+    uint64_t w = remote_get_value(thread_state_allocator_, &ts->join_word);
+    if (w & join_word_completed) {
+      common::verbose("Thread %p is already joined", ts);
+      return unpack_retval<T>(w);
+    }
+
+    bool migrated = true;
+    suspend([&](context_frame* cf) {
+      suspended_state ss = evacuate(cf);
+
+      remote_put_value(thread_state_allocator_, ss, &ts->suspended);
+
+      // race
+      w = remote_cas_value(thread_state_allocator_, join_word_waiting, uint64_t(0), &ts->join_word);
+      if (w == 0) {
+        common::verbose("Win the join race for thread %p (joining thread)", ts);
+        common::profiler::switch_phase<prof_phase_sched_join, prof_phase_sched_loop>();
+        resume_sched();
+      } else {
+        common::verbose("Lose the join race for thread %p (joining thread)", ts);
+        suspended_thread_allocator_.deallocate(ss.evacuation_ptr, ss.frame_size);
+        migrated = false;
+      }
+    });
+
+    common::verbose("Resume continuation of join for thread %p", ts);
+
+    if (migrated) {
+      common::profiler::switch_phase<prof_phase_sched_resume_join, prof_phase_sched_join>();
+      // The joined thread resumed this thread on the same process right after it was completed
+      w = handed_join_word_;
+    }
+
+    return unpack_retval<T>(w);
+  }
+
+  template <typename T>
+  void on_die_packed(thread_state<T>* ts, const T& ret) {
+    uint64_t w = pack_retval(ret);
+
+    // race
+    uint64_t prev = remote_cas_value(thread_state_allocator_, w, uint64_t(0), &ts->join_word);
+    if (prev == 0) {
+      common::verbose("Win the join race for thread %p (joined thread)", ts);
+      common::profiler::switch_phase<prof_phase_sched_die, prof_phase_sched_loop>();
+      resume_sched();
+    } else {
+      ITYR_CHECK(prev == join_word_waiting);
+      common::verbose("Lose the join race for thread %p (joined thread)", ts);
+      common::profiler::switch_phase<prof_phase_sched_die, prof_phase_sched_resume_join>();
+      // Pass the return value to the joining thread locally, as it is resumed by this process
+      handed_join_word_ = w;
+      suspended_state ss = remote_get_value(thread_state_allocator_, &ts->suspended);
+      resume(ss);
+    }
+  }
+
   template <typename T>
   void on_root_die(thread_state<T>* ts, T&& ret) {
     if constexpr (!std::is_same_v<T, no_retval_t> || dag_profiler::enabled) {
@@ -465,24 +960,151 @@ private:
     }
     remote_put_value(thread_state_allocator_, 1, &ts->resume_flag);
 
-    exit_request_mailbox_.put(0);
+    // The scheduling loop exits after all root threads are completed (see should_exit_sched_loop())
+    root_done_.put(0);
 
     common::profiler::switch_phase<prof_phase_sched_die, prof_phase_sched_loop>();
     resume_sched();
   }
 
+  static constexpr uintptr_t future_completed = 1;
+
+  struct future_waiter {
+    suspended_state ss;
+    uintptr_t       next;
+  };
+
+  template <typename T>
+  void complete_future(future_state<T>* fs, T&& ret) {
+    if constexpr (!std::is_same_v<T, no_retval_t> || dag_profiler::enabled) {
+      put_retval_remote(fs, {std::move(ret), tls_->dag_prof});
+    }
+
+    // Close the waiter list and make all waiters ready to be resumed by this process
+    uintptr_t w = remote_swap_value(thread_state_allocator_, future_completed, &fs->waiters);
+    while (w) {
+      future_waiter* fw = reinterpret_cast<future_waiter*>(w);
+      future_waiter fwv = remote_get_value(thread_state_allocator_, fw);
+      common::verbose("Thread waiting for future %p is ready", fs);
+      ready_threads_.push_back(fwv.ss);
+      thread_state_allocator_.deallocate(fw, sizeof(future_waiter));
+      w = fwv.next;
+    }
+
+    future_release(fs);
+  }
+
+  void wait_future(uintptr_t* waiters) {
+    queued_continuations qc;
+
+    bool suspended = true;
+    suspend([&](context_frame* cf) {
+      suspended_state ss = evacuate_with_queue(cf, qc);
+
+      future_waiter* fw = new (thread_state_allocator_.allocate(sizeof(future_waiter))) future_waiter{ss, 0};
+
+      uintptr_t head = remote_get_value(thread_state_allocator_, waiters);
+      while (head != future_completed) {
+        fw->next = head;
+        uintptr_t prev = remote_cas_value(thread_state_allocator_, reinterpret_cast<uintptr_t>(fw), head, waiters);
+        if (prev == head) {
+          common::verbose("Suspend thread waiting for future");
+          common::profiler::switch_phase<prof_phase_sched_join, prof_phase_sched_loop>();
+          resume_sched();
+        }
+        head = prev;
+      }
+
+      // The future has been completed in the meantime
+      thread_state_allocator_.deallocate(fw, sizeof(future_waiter));
+      suspended_thread_allocator_.deallocate(ss.evacuation_ptr, ss.frame_size);
+      suspended = false;
+    });
+
+    if (suspended) {
+      common::verbose("Resume thread waiting for future");
+      common::profiler::switch_phase<prof_phase_sched_resume_join, prof_phase_sched_join>();
+    }
+
+    restore_queue(qc);
+  }
+
+  struct wsqueue_entry;
+
+  struct queued_continuations {
+    wsqueue_entry* entries = nullptr;
+    std::size_t    n       = 0;
+    std::size_t    bytes   = 0;
+  };
+
+  // Evacuate the context of a thread that will be resumed later (possibly on another process).
+  // Continuations in the local queue are stacked right below this thread and cannot be
+  // executed while this thread is away; take them with this thread's context and put them back
+  // by `restore_queue()` after resumption.
+  suspended_state evacuate_with_queue(context_frame* cf, queued_continuations& qc) {
+    // The queue size is an upper bound because no entry is pushed concurrently.
+    void* frame_end = cf->parent_frame;
+    if (wsq_.size() > 0) {
+      qc.bytes = sizeof(wsqueue_entry) * wsq_.size();
+      qc.entries = reinterpret_cast<wsqueue_entry*>(suspended_thread_allocator_.allocate(qc.bytes));
+      while (auto qe = wsq_.pop()) {
+        qc.entries[qc.n++] = *qe;
+        if (!qe->help_first) {
+          frame_end = std::max(frame_end, reinterpret_cast<void*>(
+                reinterpret_cast<std::byte*>(qe->frame_base) + qe->frame_size));
+        }
+      }
+      // The parent frame is included in the evacuated region and must not be cleared at resume
+      cf->parent_frame = nullptr;
+    }
+    return evacuate(cf, frame_end);
+  }
+
+  void restore_queue(const queued_continuations& qc) {
+    if (qc.entries) {
+      // Put the continuations back in the original order; their frames are now in the local stack
+      for (std::size_t i = qc.n; i > 0; i--) {
+        wsq_.push(remote_get_value(suspended_thread_allocator_, &qc.entries[i - 1]));
+      }
+      suspended_thread_allocator_.deallocate(qc.entries, qc.bytes);
+      if (qc.n > 0) {
+        steal_hint_.notify();
+      }
+    }
+  }
+
   void steal() {
-    auto target_rank = get_random_rank(0, common::topology::n_ranks() - 1);
+    common::topology::rank_t target_rank;
+
+    auto hinted_rank = steal_hint_.pop();
+    if (hinted_rank.has_value()) {
+      // A victim notified us of new work; try it immediately regardless of the backoff
+      target_rank = *hinted_rank;
+      steal_backoff_.reset();
+    } else {
+      if (steal_backoff_.should_wait()) {
+        return;
+      }
+
+      target_rank = choose_victim();
+
+      if (steal_backoff_.is_suppressed(target_rank)) {
+        return;
+      }
+    }
 
     auto ibd = common::profiler::interval_begin<prof_event_sched_steal>(target_rank);
 
     if (wsq_.empty(target_rank)) {
       common::profiler::interval_end<prof_event_sched_steal>(ibd, false);
+      steal_backoff_.on_failure(target_rank);
+      steal_hint_.register_waiter(target_rank);
       return;
     }
 
     if (!wsq_.lock().trylock(target_rank)) {
       common::profiler::interval_end<prof_event_sched_steal>(ibd, false);
+      steal_backoff_.on_failure(target_rank);
       return;
     }
 
@@ -490,6 +1112,16 @@ private:
     if (!we.has_value()) {
       wsq_.lock().unlock(target_rank);
       common::profiler::interval_end<prof_event_sched_steal>(ibd, false);
+      steal_backoff_.on_failure(target_rank);
+      steal_hint_.register_waiter(target_rank);
+      return;
+    }
+
+    steal_backoff_.on_success(target_rank);
+    steal_hint_.cancel();
+
+    if (we->help_first) {
+      steal_help_first_task(we->frame_base, we->frame_size, target_rank, ibd);
       return;
     }
 
@@ -524,6 +1156,58 @@ private:
     });
   }
 
+  // Choose a random victim. With priority sampling, peek at several random victims and
+  // choose the one whose next entry to be stolen has the highest priority.
+  common::topology::rank_t choose_victim() {
+    auto n_ranks = common::topology::n_ranks();
+    auto target_rank = get_random_rank(0, n_ranks - 1);
+
+    int n_samples = sched_steal_priority_samples_option::value();
+    if (n_samples <= 1) {
+      return target_rank;
+    }
+
+    std::optional<int> max_priority;
+    for (int i = 0; i < n_samples; i++) {
+      auto r = (i == 0) ? target_rank : get_random_rank(0, n_ranks - 1);
+      auto we = wsq_.peek_nolock(r);
+      if (we.has_value() && (!max_priority.has_value() || we->priority > *max_priority)) {
+        target_rank  = r;
+        max_priority = we->priority;
+      }
+    }
+    return target_rank;
+  }
+
+  template <typename IntervalBeginData>
+  void steal_help_first_task(void* task_base, std::size_t task_size,
+                             common::topology::rank_t target_rank, IntervalBeginData ibd) {
+    common::verbose("Steal help-first task %p from rank %d", task_base, target_rank);
+
+    // The task is copied by value, and thus it can be started anywhere in the local stack
+    void* task_ptr = suspended_thread_allocator_.allocate(task_size);
+    common::remote_get(suspended_thread_allocator_,
+                       reinterpret_cast<std::byte*>(task_ptr),
+                       reinterpret_cast<std::byte*>(task_base),
+                       task_size);
+
+    wsq_.lock().unlock(target_rank);
+
+    common::profiler::interval_end<prof_event_sched_steal>(ibd, true);
+
+    common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_sched_resume_stolen>();
+
+    auto t = static_cast<help_first_task_base*>(task_ptr);
+
+    suspend([&](context_frame* cf) {
+      sched_cf_ = cf;
+      // Keep a margin so that the new thread is not regarded as the root thread
+      on_stack(stack_base_ - 1, [this, t, task_size]() {
+        t->execute_stolen(*this, task_size);
+      });
+    });
+  }
+
   template <typename Fn>
   void suspend(Fn&& fn) {
     // SEC_PROF_BEGIN("suspend");
@@ -574,9 +1258,17 @@ private:
     context::resume(sched_cf_);
   }
 
+  void execute_ready_thread(const suspended_state& ss) {
+    common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_sched_resume_join>();
+    suspend([&](context_frame* cf) {
+      sched_cf_ = cf;
+      resume(ss);
+    });
+  }
+
   void execute_migrated_task(const suspended_state& ss) {
     ITYR_CHECK(ss.evacuation_ptr);
-    common::verbose("Received a continuation of the root thread");
+    common::verbose("Received a migrated continuation");
     common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_sched_resume_migrate>();
     suspend([&](context_frame* cf) {
       sched_cf_ = cf;
@@ -585,20 +1277,29 @@ private:
   }
 
   suspended_state evacuate(context_frame* cf) {
-    std::size_t cf_size = reinterpret_cast<uintptr_t>(cf->parent_frame) - reinterpret_cast<uintptr_t>(cf);
+    return evacuate(cf, cf->parent_frame);
+  }
+
+  suspended_state evacuate(context_frame* cf, void* frame_end) {
+    std::size_t cf_size = reinterpret_cast<uintptr_t>(frame_end) - reinterpret_cast<uintptr_t>(cf);
     void* evacuation_ptr = suspended_thread_allocator_.allocate(cf_size);
     std::memcpy(evacuation_ptr, cf, cf_size);
 
     common::verbose("Evacuate suspended thread context [%p, %p) to %p",
-                    cf, cf->parent_frame, evacuation_ptr);
+                    cf, frame_end, evacuation_ptr);
 
     return {evacuation_ptr, cf, cf_size};
   }
 
   template <typename Fn>
   void root_on_stack(Fn&& fn) {
-    cf_top_ = stack_base_;
-    std::size_t stack_size_bytes = reinterpret_cast<std::byte*>(stack_base_) -
+    on_stack(stack_base_, std::forward<Fn>(fn));
+  }
+
+  template <typename Fn>
+  void on_stack(context_frame* base, Fn&& fn) {
+    cf_top_ = base;
+    std::size_t stack_size_bytes = reinterpret_cast<std::byte*>(base) -
                                    reinterpret_cast<std::byte*>(stack_.top());
     context::call_on_stack(stack_.top(), stack_size_bytes,
                            [](void* fn_, void*, void*, void*) {
@@ -607,44 +1308,45 @@ private:
     }, &fn, nullptr, nullptr, nullptr);
   }
 
-  void execute_coll_task(task_general* t, coll_task ct) {
+  int execute_coll_task(task_general* t, coll_task ct) {
     // TODO: consider copy semantics for tasks
     coll_task ct_ {t, ct.task_size, ct.master_rank};
 
     // pass coll task to other processes in a binary tree form
-    auto n_ranks = common::topology::n_ranks();
-    auto my_rank = common::topology::my_rank();
-    auto my_rank_shifted = (my_rank + n_ranks - ct.master_rank) % n_ranks;
-    for (common::topology::rank_t i = common::next_pow2(n_ranks); i > 1; i /= 2) {
-      if (my_rank_shifted % i == 0) {
-        auto target_rank_shifted = my_rank_shifted + i / 2;
-        if (target_rank_shifted < n_ranks) {
-          auto target_rank = (target_rank_shifted + ct.master_rank) % n_ranks;
-          coll_task_mailbox_.put(ct_, target_rank);
-        }
-      }
-    }
+    int n_children = 0;
+    for_each_coll_tree_child(ct.master_rank, [&](common::topology::rank_t target_rank) {
+      coll_task_mailbox_.put(ct_, target_rank);
+      n_children++;
+    });
 
+    // Allocate half the rest of the stack space for nested root/coll_exec().
+    // Because the current stack base is identical on all processes, every process can compute
+    // the next stack base without communication.
     auto prev_stack_base = stack_base_;
-    if (my_rank == ct.master_rank) {
-      // Allocate half the rest of the stack space for nested root/coll_exec()
-      stack_base_ = cf_top_ - (cf_top_ - reinterpret_cast<context_frame*>(stack_.top())) / 2;
+    stack_base_ = stack_base_ - (stack_base_ - reinterpret_cast<context_frame*>(stack_.top())) / 2;
+
+    if (common::topology::my_rank() == ct.master_rank) {
+      // The stack frames of the master worker running this coll task are in the RDMA-capable
+      // stack region, which must not overlap with those of nested root_exec() calls
+      if (reinterpret_cast<std::byte*>(__builtin_frame_address(0)) <=
+          reinterpret_cast<std::byte*>(stack_base_)) {
+        common::die("[ityr::ito::scheduler] The call stack is too deep to call coll_exec(); "
+                    "try a larger stack size (ITYR_ITO_STACK_SIZE)");
+      }
     }
 
-    // In addition, collectively set the next stack base for nested root_exec() calls because
-    // the stack frame of the scheduler of the master worker is in the RDMA-capable stack region.
-    // TODO: check if the scheduler's stack frame and nested root_exec()'s stack frame do not overlap
-    stack_base_ = common::mpi_bcast_value(stack_base_, ct.master_rank, common::topology::mpicomm());
-
-    // Ensure all processes have finished coll task execution before deallocation.
-    common::mpi_barrier(common::topology::mpicomm());
-
     t->execute();
 
     stack_base_ = prev_stack_base;
 
-    // Ensure all processes have finished coll task execution before deallocation
-    common::mpi_barrier(common::topology::mpicomm());
+    return n_children;
+  }
+
+  void wait_coll_task_children(const coll_task& ct, int n_children) {
+    coll_task_done_.wait(n_children, common::topology::my_rank());
+
+    // Notify the parent after all descendants have completed
+    coll_task_done_.put(coll_tree_parent(ct.master_rank));
   }
 
   void execute_coll_task_if_arrived() {
@@ -660,7 +1362,9 @@ private:
 
       common::profiler::switch_phase<prof_phase_sched_loop, prof_phase_spmd>();
 
-      execute_coll_task(t, *ct);
+      int n_children = execute_coll_task(t, *ct);
+
+      wait_coll_task_children(*ct, n_children);
 
       common::profiler::switch_phase<prof_phase_spmd, prof_phase_sched_loop>();
 
@@ -675,8 +1379,10 @@ private:
 
     execute_coll_task_if_arrived();
 
-    if (exit_request_mailbox_.pop()) {
-      auto my_rank = common::topology::my_rank();
+    auto my_rank = common::topology::my_rank();
+
+    // Process 0 detects the completion of all root threads and propagates exit requests
+    if ((my_rank == 0 && root_done_.try_wait(n_roots_)) || exit_request_mailbox_.pop()) {
       auto n_ranks = common::topology::n_ranks();
       for (common::topology::rank_t i = common::next_pow2(n_ranks); i > 1; i /= 2) {
         if (my_rank % i == 0) {
@@ -715,17 +1421,36 @@ private:
     }
   }
 
+  // Results of futures are always trivially copyable
+  template <typename T>
+  thread_retval<T> get_retval_remote(future_state<T>* fs) {
+    return remote_get_value(thread_state_allocator_, &fs->retval);
+  }
+
+  template <typename T>
+  void put_retval_remote(future_state<T>* fs, thread_retval<T>&& retval) {
+    remote_put_value(thread_state_allocator_, retval, &fs->retval);
+  }
+
   struct wsqueue_entry {
     void*       frame_base;
     std::size_t frame_size;
+    bool        help_first = false; // `frame_base` points to a help_first_task if true
+    int         priority   = 0;
   };
 
   callstack                        stack_;
   context_frame*                   stack_base_;
   oneslot_mailbox<void>            exit_request_mailbox_;
+  arrival_counter                  root_done_;
+  int                              n_roots_          = 1;
   oneslot_mailbox<coll_task>       coll_task_mailbox_;
-  oneslot_mailbox<suspended_state> migration_mailbox_;
+  arrival_counter                  coll_task_done_;
+  mpsc_mailbox<suspended_state>    migration_mailbox_;
+  std::deque<suspended_state>      ready_threads_;
   wsqueue<wsqueue_entry>           wsq_;
+  steal_backoff                    steal_backoff_;
+  steal_hint                       steal_hint_;
   common::remotable_resource       thread_state_allocator_;
   common::remotable_resource       suspended_thread_allocator_;
   context_frame*                   cf_top_           = nullptr;
@@ -733,6 +1458,7 @@ private:
   thread_local_storage*            tls_              = nullptr;
   bool                             dag_prof_enabled_ = false;
   dag_profiler                     dag_prof_result_;
+  uint64_t                         handed_join_word_ = 0;
 };
 
 }
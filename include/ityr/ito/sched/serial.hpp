@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include "ityr/common/util.hpp"
 #include "ityr/ito/util.hpp"
 #include "ityr/ito/sched/util.hpp"
@@ -18,14 +20,75 @@ public:
     return invoke_fn<T>(std::forward<Fn>(fn), std::make_tuple(std::forward<Args>(args)...));
   }
 
+  template <typename T, typename SchedLoopCallback, typename Fn, typename... Args>
+  T root_exec_each(SchedLoopCallback cb, Fn&& fn, Args&&... args) {
+    return root_exec<T>(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
+  }
+
   template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
             typename WorkHint, typename Fn, typename... Args>
   void fork(thread_handler<T>& th,
             OnDriftForkCallback, OnDriftDieCallback,
-            WorkHint, WorkHint, Fn&& fn, Args&&... args) {
+            WorkHint, WorkHint, int, Fn&& fn, Args&&... args) {
     th = invoke_fn<T>(std::forward<Fn>(fn), std::make_tuple(std::forward<Args>(args)...));
   }
 
+  // Fork policies make no difference in serial execution
+  template <typename T, typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename WorkHint, typename Fn, typename... Args>
+  void fork_help_first(thread_handler<T>& th,
+                       OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
+                       WorkHint w_new, WorkHint w_rest, int priority, Fn&& fn, Args&&... args) {
+    fork(th, on_drift_fork_cb, on_drift_die_cb, w_new, w_rest, priority,
+         std::forward<Fn>(fn), std::forward<Args>(args)...);
+  }
+
+  // Async tasks are executed eagerly when they are created
+  template <typename T>
+  using future_handler = T;
+
+  template <typename T, typename OnDriftForkCallback, typename OnDieCallback,
+            typename Fn, typename... Args>
+  void async(future_handler<T>& fh,
+             OnDriftForkCallback, OnDieCallback,
+             Fn&& fn, Args&&... args) {
+    fh = invoke_fn<T>(std::forward<Fn>(fn), std::make_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename T>
+  bool future_ready(const future_handler<T>&) const {
+    return true;
+  }
+
+  template <typename T>
+  T future_get(const future_handler<T>& fh) {
+    return fh;
+  }
+
+  template <typename T>
+  void future_retain(const future_handler<T>&) {}
+
+  template <typename T>
+  void future_release(const future_handler<T>&) {}
+
+  using cancel_handler = std::size_t*;
+
+  cancel_handler cancel_scope_begin() {
+    return new std::size_t(std::numeric_limits<std::size_t>::max());
+  }
+
+  void cancel_scope_end(cancel_handler ch) {
+    delete ch;
+  }
+
+  void cancel(cancel_handler ch, std::size_t pos) {
+    *ch = std::min(*ch, pos);
+  }
+
+  bool is_cancelled(cancel_handler ch, std::size_t pos) const {
+    return *ch <= pos;
+  }
+
   template <typename T>
   T join(thread_handler<T>& th) {
     return std::move(th);
@@ -40,15 +103,33 @@ public:
   template <typename PreSuspendCallback, typename PostSuspendCallback>
   void migrate_to(common::topology::rank_t, PreSuspendCallback&&, PostSuspendCallback&&) {}
 
+  struct coll_task_handle {};
+
   template <typename Fn>
   void coll_exec(const Fn& fn) {
     fn();
   }
 
+  template <typename Fn>
+  coll_task_handle coll_exec_nb(const Fn& fn) {
+    fn();
+    return {};
+  }
+
+  void coll_exec_wait(const coll_task_handle&) {}
+
   bool is_executing_root() const {
     return true;
   }
 
+  std::size_t stack_high_water_mark() const {
+    return 0;
+  }
+
+  bool should_split() const {
+    return false;
+  }
+
   template <typename T>
   static bool is_serialized(const thread_handler<T>&) {
     return true;
@@ -2,18 +2,38 @@
 
 #include <random>
 #include <atomic>
+#include <limits>
+#include <deque>
 
 #include "ityr/common/util.hpp"
 #include "ityr/common/topology.hpp"
 #include "ityr/common/mpi_util.hpp"
 #include "ityr/common/mpi_rma.hpp"
+#include "ityr/common/allocator.hpp"
 #include "ityr/common/wallclock.hpp"
+#include "ityr/common/profiler.hpp"
 #include "ityr/ito/util.hpp"
 #include "ityr/ito/options.hpp"
 #include "ityr/ito/prof_events.hpp"
 
 namespace ityr::ito {
 
+/*
+ * Task priority
+ */
+
+// Priority of a thread. Thieves prefer work exposed by higher-priority threads when
+// ITYR_ITO_SCHED_STEAL_PRIORITY_SAMPLES > 1 (randws only). A child thread inherits the priority
+// of its parent unless specified at fork. The work exposed by a work-first fork is the parent's
+// continuation, and thus it has the parent's priority; a help-first child has its own priority.
+struct task_priority {
+  static constexpr int inherit = std::numeric_limits<int>::min();
+
+  constexpr explicit task_priority(int p) : value(p) {}
+
+  int value;
+};
+
 /*
  * DAG profiler
  */
@@ -292,4 +312,318 @@ private:
   common::mpi_win_manager<mailbox> win_;
 };
 
+/*
+ * Multi-producer mailbox
+ */
+
+// Unlike oneslot_mailbox, multiple entries can be put at the same time (e.g., continuations of
+// threads migrated to the same process). Entries are linked in a list allocated from `allocator`.
+template <typename Entry>
+class mpsc_mailbox {
+  static_assert(std::is_trivially_copyable_v<Entry>);
+
+public:
+  mpsc_mailbox(common::remotable_resource& allocator)
+    : win_(common::topology::mpicomm(), 1),
+      allocator_(allocator) {}
+
+  void put(const Entry& entry, common::topology::rank_t target_rank) {
+    ITYR_PROFILER_RECORD(prof_event_sched_mailbox_put, target_rank);
+
+    node* n = new (allocator_.allocate(sizeof(node))) node{entry, 0};
+
+    uintptr_t head = common::mpi_atomic_get_value<uintptr_t>(target_rank, 0, win_.win());
+    while (true) {
+      n->next = head;
+      uintptr_t prev = common::mpi_atomic_cas_value(reinterpret_cast<uintptr_t>(n), head,
+                                                    target_rank, 0, win_.win());
+      if (prev == head) break;
+      head = prev;
+    }
+  }
+
+  std::optional<Entry> pop() {
+    if (pending_.empty() && arrived()) {
+      // Take the whole list and consume it in FIFO order
+      uintptr_t head = common::mpi_atomic_put_value<uintptr_t>(0, common::topology::my_rank(), 0, win_.win());
+      while (head) {
+        node* n = reinterpret_cast<node*>(head);
+        node nv = common::remote_get_value(allocator_, n);
+        pending_.push_front(nv.entry);
+        allocator_.deallocate(n, sizeof(node));
+        head = nv.next;
+      }
+    }
+
+    if (pending_.empty()) {
+      return std::nullopt;
+    }
+
+    Entry e = pending_.front();
+    pending_.pop_front();
+    return e;
+  }
+
+  bool arrived() const {
+    return !pending_.empty() ||
+           win_.local_buf()[0].load(std::memory_order_relaxed) != 0;
+  }
+
+private:
+  struct node {
+    Entry     entry;
+    uintptr_t next;
+  };
+
+  common::mpi_win_manager<std::atomic<uintptr_t>> win_;
+  common::remotable_resource&                     allocator_;
+  std::deque<Entry>                               pending_;
+};
+
+/*
+ * Arrival counter
+ */
+
+// Counts notifications (e.g., task completion) put by other processes.
+// Unlike oneslot_mailbox, multiple notifications can be put at the same time.
+class arrival_counter {
+public:
+  arrival_counter()
+    : win_(common::topology::mpicomm(), 1) {}
+
+  void put(common::topology::rank_t target_rank) {
+    ITYR_PROFILER_RECORD(prof_event_sched_mailbox_put, target_rank);
+    common::mpi_atomic_faa_value(1, target_rank, 0, win_.win());
+  }
+
+  // Wait for `n` notifications to arrive at the process `owner_rank` and consume them.
+  // This can be called by a process other than the owner (e.g., after thread migration).
+  void wait(int n, common::topology::rank_t owner_rank) {
+    if (n == 0) return;
+
+    if (owner_rank == common::topology::my_rank()) {
+      std::atomic<int>& count = win_.local_buf()[0];
+      while (count.load(std::memory_order_acquire) < n) {
+        common::mpi_make_progress();
+      }
+      count.fetch_sub(n, std::memory_order_relaxed);
+    } else {
+      while (common::mpi_atomic_get_value<int>(owner_rank, 0, win_.win()) < n);
+      common::mpi_atomic_faa_value(-n, owner_rank, 0, win_.win());
+    }
+  }
+
+  // Non-blocking version of `wait()`, which can be called only by the owner process
+  bool try_wait(int n) {
+    std::atomic<int>& count = win_.local_buf()[0];
+    if (count.load(std::memory_order_acquire) < n) {
+      return false;
+    }
+    count.fetch_sub(n, std::memory_order_relaxed);
+    return true;
+  }
+
+private:
+  common::mpi_win_manager<std::atomic<int>> win_;
+};
+
+/*
+ * Collective task tree
+ */
+
+// Processes are organized in a binary tree rooted at `root_rank` for distributing coll tasks
+// and for gathering their completion.
+template <typename Fn>
+inline void for_each_coll_tree_child(common::topology::rank_t root_rank, Fn&& fn) {
+  auto n_ranks = common::topology::n_ranks();
+  auto my_rank = common::topology::my_rank();
+  auto my_rank_shifted = (my_rank + n_ranks - root_rank) % n_ranks;
+  for (common::topology::rank_t i = common::next_pow2(n_ranks); i > 1; i /= 2) {
+    if (my_rank_shifted % i == 0) {
+      auto target_rank_shifted = my_rank_shifted + i / 2;
+      if (target_rank_shifted < n_ranks) {
+        fn((target_rank_shifted + root_rank) % n_ranks);
+      }
+    }
+  }
+}
+
+inline common::topology::rank_t coll_tree_parent(common::topology::rank_t root_rank) {
+  auto n_ranks = common::topology::n_ranks();
+  auto my_rank = common::topology::my_rank();
+  auto my_rank_shifted = (my_rank + n_ranks - root_rank) % n_ranks;
+  ITYR_CHECK(my_rank_shifted != 0);
+  // The parent is obtained by clearing the lowest set bit
+  auto parent_rank_shifted = my_rank_shifted & (my_rank_shifted - 1);
+  return (parent_rank_shifted + root_rank) % n_ranks;
+}
+
+/*
+ * Steal backoff
+ */
+
+// Adaptive exponential backoff with jitter for idle workers whose steal attempts keep failing.
+// Failures are also remembered per victim so that a victim recently found empty is not
+// repeatedly hit by the same thief.
+class steal_backoff {
+public:
+  steal_backoff()
+    : enabled_(sched_steal_backoff_option::value()),
+      min_ns_(sched_steal_backoff_min_ns_option::value()),
+      max_ns_(std::max(sched_steal_backoff_max_ns_option::value(), min_ns_)),
+      victims_(enabled_ ? common::topology::n_ranks() : 0),
+      engine_(std::random_device{}()) {}
+
+  bool should_wait() {
+    if (!enabled_ || !waiting_) return false;
+
+    if (common::clock_gettime_ns() < next_attempt_t_) {
+      return true;
+    }
+
+    end_wait();
+    return false;
+  }
+
+  bool is_suppressed(common::topology::rank_t target_rank) const {
+    return enabled_ && common::clock_gettime_ns() < victims_[target_rank].retry_t;
+  }
+
+  void on_failure(common::topology::rank_t target_rank) {
+    if (!enabled_) return;
+
+    auto t = common::clock_gettime_ns();
+
+    victim_state& vs = victims_[target_rank];
+    vs.n_failures++;
+    vs.retry_t = t + delay(vs.n_failures);
+
+    n_failures_++;
+    next_attempt_t_ = t + delay(n_failures_);
+
+    if (!waiting_) {
+      waiting_ = true;
+      ibd_ = common::profiler::interval_begin<prof_event_sched_steal_backoff>();
+    }
+  }
+
+  void on_success(common::topology::rank_t target_rank) {
+    if (!enabled_) return;
+
+    victims_[target_rank] = {};
+    reset();
+  }
+
+  void reset() {
+    if (!enabled_) return;
+
+    if (waiting_) {
+      end_wait();
+    }
+    n_failures_ = 0;
+  }
+
+private:
+  struct victim_state {
+    int      n_failures = 0;
+    uint64_t retry_t    = 0;
+  };
+
+  void end_wait() {
+    waiting_ = false;
+    common::profiler::interval_end<prof_event_sched_steal_backoff>(ibd_);
+  }
+
+  // Equal jitter: a random delay in [d/2, d], where d = min(max, min * 2^(n_failures - 1))
+  std::size_t delay(int n_failures) {
+    int shift = std::min(n_failures - 1, std::numeric_limits<std::size_t>::digits - 1);
+    std::size_t d = (min_ns_ > (max_ns_ >> shift)) ? max_ns_ : (min_ns_ << shift);
+    return std::uniform_int_distribution<std::size_t>(d / 2, d)(engine_);
+  }
+
+  bool                                  enabled_;
+  std::size_t                           min_ns_;
+  std::size_t                           max_ns_;
+  std::vector<victim_state>             victims_;
+  std::mt19937                          engine_;
+  int                                   n_failures_     = 0;
+  uint64_t                              next_attempt_t_ = 0;
+  bool                                  waiting_        = false;
+  common::profiler::interval_begin_data ibd_;
+};
+
+/*
+ * Steal hint
+ */
+
+// A "work-available" hint published by victims. An idle thief registers itself at a victim
+// whose queue it found empty, and the victim notifies the registered thief with a single
+// atomic put when it pushes new work. Thieves thus check a local word instead of polling
+// remote queues.
+class steal_hint {
+public:
+  steal_hint()
+    : enabled_(sched_steal_hint_option::value()),
+      win_(common::topology::mpicomm(), 1) {}
+
+  bool enabled() const { return enabled_; }
+
+  // thief side
+  void register_waiter(common::topology::rank_t target_rank) {
+    if (!enabled_ || registered_) return;
+
+    auto my_rank = common::topology::my_rank();
+    auto prev = common::mpi_atomic_cas_value(my_rank, -1, target_rank, offsetof(hint_state, waiter), win_.win());
+    registered_ = (prev == -1);
+  }
+
+  std::optional<common::topology::rank_t> pop() {
+    if (!enabled_) return std::nullopt;
+
+    hint_state& hs = win_.local_buf()[0];
+    common::topology::rank_t v = hs.hinted_rank.load(std::memory_order_acquire);
+    if (v >= 0) {
+      hs.hinted_rank.store(-1, std::memory_order_relaxed);
+      registered_ = false;
+      return v;
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  void cancel() {
+    // The registration left at the victim may later produce a spurious hint, which only
+    // costs one extra steal attempt.
+    registered_ = false;
+  }
+
+  // victim side
+  bool has_waiter() const {
+    return enabled_ && win_.local_buf()[0].waiter.load(std::memory_order_relaxed) >= 0;
+  }
+
+  void notify() {
+    if (!enabled_) return;
+
+    hint_state& hs = win_.local_buf()[0];
+    if (hs.waiter.load(std::memory_order_relaxed) >= 0) {
+      common::topology::rank_t waiter = hs.waiter.exchange(-1, std::memory_order_relaxed);
+      if (waiter >= 0) {
+        common::mpi_atomic_put_value(common::topology::my_rank(), waiter,
+                                     offsetof(hint_state, hinted_rank), win_.win());
+      }
+    }
+  }
+
+private:
+  struct hint_state {
+    std::atomic<common::topology::rank_t> waiter      = -1; // TODO: better to use std::atomic_ref in C++20
+    std::atomic<common::topology::rank_t> hinted_rank = -1;
+  };
+
+  bool                                enabled_;
+  common::mpi_win_manager<hint_state> win_;
+  bool                                registered_ = false;
+};
+
 }
@@ -19,6 +19,14 @@ struct workhint {
   W work_rest;
 };
 
+// Work-first: run the child first and make the continuation stealable (default).
+// Help-first: make the child stealable as a closure and continue the parent first.
+// Help-first children must be joined in the reverse order of forks.
+enum class fork_policy {
+  work_first,
+  help_first,
+};
+
 template <typename T>
 class thread {
   // If the return value is void, set `no_retval_t` as the return type for the internal of the scheduler
@@ -55,6 +63,22 @@ public:
   thread(const thread&) = delete;
   thread& operator=(const thread&) = delete;
 
+  template <typename... Rest>
+  thread(fork_policy policy, Rest&&... rest) : policy_(policy) {
+    fork(std::forward<Rest>(rest)...);
+  }
+
+  template <typename... Rest>
+  thread(task_priority priority, Rest&&... rest) : priority_(priority.value) {
+    fork(std::forward<Rest>(rest)...);
+  }
+
+  template <typename... Rest>
+  thread(fork_policy policy, task_priority priority, Rest&&... rest)
+    : policy_(policy), priority_(priority.value) {
+    fork(std::forward<Rest>(rest)...);
+  }
+
   thread(thread&& th) = default;
   thread& operator=(thread&& th) = default;
 
@@ -62,8 +86,8 @@ public:
   void fork(Fn&& fn, Args&&... args) {
     auto& w = worker::instance::get();
     ITYR_CHECK(!w.is_spmd());
-    w.sched().fork(handler_, nullptr, nullptr,
-                   1, 1, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    do_fork(w, nullptr, nullptr,
+            1, 1, std::forward<Fn>(fn), std::forward<Args>(args)...);
   }
 
   template <typename OnDriftForkCallback, typename OnDriftDieCallback, typename Fn, typename... Args>
@@ -71,17 +95,16 @@ public:
             Fn&& fn, Args&&... args) {
     auto& w = worker::instance::get();
     ITYR_CHECK(!w.is_spmd());
-    w.sched().fork(handler_,
-                   on_drift_fork_cb, on_drift_die_cb,
-                   1, 1, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    do_fork(w, on_drift_fork_cb, on_drift_die_cb,
+            1, 1, std::forward<Fn>(fn), std::forward<Args>(args)...);
   }
 
   template <typename W, typename Fn, typename... Args>
   void fork(workhint<W> wh, Fn&& fn, Args&&... args) {
     auto& w = worker::instance::get();
     ITYR_CHECK(!w.is_spmd());
-    w.sched().fork(handler_, nullptr, nullptr,
-                   wh.work_new, wh.work_rest, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    do_fork(w, nullptr, nullptr,
+            wh.work_new, wh.work_rest, std::forward<Fn>(fn), std::forward<Args>(args)...);
   }
 
   template <typename OnDriftForkCallback, typename OnDriftDieCallback,
@@ -90,9 +113,8 @@ public:
             workhint<W> wh, Fn&& fn, Args&&... args) {
     auto& w = worker::instance::get();
     ITYR_CHECK(!w.is_spmd());
-    w.sched().fork(handler_,
-                   on_drift_fork_cb, on_drift_die_cb,
-                   wh.work_new, wh.work_rest, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    do_fork(w, on_drift_fork_cb, on_drift_die_cb,
+            wh.work_new, wh.work_rest, std::forward<Fn>(fn), std::forward<Args>(args)...);
   }
 
   T join() {
@@ -110,7 +132,25 @@ public:
   }
 
 private:
+  template <typename OnDriftForkCallback, typename OnDriftDieCallback,
+            typename W, typename Fn, typename... Args>
+  void do_fork(worker::worker& w,
+               OnDriftForkCallback on_drift_fork_cb, OnDriftDieCallback on_drift_die_cb,
+               W w_new, W w_rest, Fn&& fn, Args&&... args) {
+    if (policy_ == fork_policy::help_first) {
+      w.sched().fork_help_first(handler_,
+                                on_drift_fork_cb, on_drift_die_cb,
+                                w_new, w_rest, priority_, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    } else {
+      w.sched().fork(handler_,
+                     on_drift_fork_cb, on_drift_die_cb,
+                     w_new, w_rest, priority_, std::forward<Fn>(fn), std::forward<Args>(args)...);
+    }
+  }
+
   scheduler::thread_handler<sched_retval_t> handler_;
+  fork_policy                               policy_   = fork_policy::work_first;
+  int                                       priority_ = task_priority::inherit;
 };
 
 }
@@ -6,6 +6,9 @@
 
 namespace ityr::ito::worker {
 
+template <typename T>
+class coll_exec_handle;
+
 class worker {
 public:
   worker()
@@ -14,6 +17,13 @@ public:
   template <typename SchedLoopCallback, typename Fn, typename... Args>
   auto root_exec(SchedLoopCallback cb, Fn&& fn, Args&&... args) {
     ITYR_CHECK(is_spmd_);
+
+    if (coll_task_depth_ > 0) {
+      // coll tasks are started without global synchronization, so ensure that all processes have
+      // entered the current coll task before new coll tasks can be issued by the nested root thread
+      common::mpi_barrier(common::topology::mpicomm());
+    }
+
     is_spmd_ = false;
 
     using retval_t = std::invoke_result_t<Fn, Args...>;
@@ -48,17 +58,57 @@ public:
     }
   }
 
+  template <typename SchedLoopCallback, typename Fn, typename... Args>
+  auto root_exec_each(SchedLoopCallback cb, Fn&& fn, Args&&... args) {
+    ITYR_CHECK(is_spmd_);
+    // root threads cannot be started by multiple processes within coll tasks
+    ITYR_CHECK(coll_task_depth_ == 0);
+
+    is_spmd_ = false;
+    multi_root_ = true;
+
+    using retval_t = std::invoke_result_t<Fn, Args...>;
+    if constexpr (std::is_void_v<retval_t>) {
+      sched_.root_exec_each<no_retval_t>(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
+
+      multi_root_ = false;
+      is_spmd_ = true;
+
+      common::mpi_barrier(common::topology::mpicomm());
+
+    } else {
+      retval_t retval = sched_.root_exec_each<retval_t>(cb, std::forward<Fn>(fn), std::forward<Args>(args)...);
+
+      multi_root_ = false;
+      is_spmd_ = true;
+
+      common::mpi_barrier(common::topology::mpicomm());
+
+      return retval;
+    }
+  }
+
   template <typename Fn, typename... Args>
   auto coll_exec(const Fn& fn, const Args&... args) {
+    return coll_exec_nb(fn, args...).wait();
+  }
+
+  template <typename Fn, typename... Args>
+  auto coll_exec_nb(const Fn& fn, const Args&... args) {
     ITYR_CHECK(!is_spmd_);
+    // coll tasks issued by multiple root threads would conflict with each other
+    ITYR_CHECK(!multi_root_);
 
     using retval_t = std::invoke_result_t<Fn, Args...>;
 
     auto next_master = common::topology::my_rank();
     std::conditional_t<std::is_void_v<retval_t>, no_retval_t, retval_t> retv;
 
+    // The master process executes this function before coll_exec_nb() returns,
+    // and thus `retv` can be captured by reference
     auto coll_task_fn = [=, &retv]() {
       is_spmd_ = true;
+      coll_task_depth_++;
       auto prev_coll_master = coll_master_;
       coll_master_ = next_master;
       if constexpr (std::is_void_v<retval_t>) {
@@ -71,14 +121,13 @@ public:
         }
       }
       coll_master_ = prev_coll_master;
+      coll_task_depth_--;
       is_spmd_ = false;
     };
 
-    sched_.coll_exec(coll_task_fn);
+    auto h = sched_.coll_exec_nb(coll_task_fn);
 
-    if constexpr (!std::is_void_v<retval_t>) {
-      return retv;
-    }
+    return coll_exec_handle<retval_t>(h, std::move(retv));
   }
 
   bool is_spmd() const { return is_spmd_; }
@@ -89,8 +138,52 @@ private:
   scheduler                sched_;
   bool                     is_spmd_ = true;
   common::topology::rank_t coll_master_ = 0;
+  int                      coll_task_depth_ = 0;
+  bool                     multi_root_ = false;
 };
 
 using instance = common::singleton<worker>;
 
+template <typename T>
+class coll_exec_handle {
+  using retval_t = std::conditional_t<std::is_void_v<T>, no_retval_t, T>;
+
+public:
+  coll_exec_handle() {}
+  coll_exec_handle(const scheduler::coll_task_handle& h, retval_t&& retval)
+    : h_(h), retval_(std::move(retval)), valid_(true) {}
+
+  coll_exec_handle(const coll_exec_handle&) = delete;
+  coll_exec_handle& operator=(const coll_exec_handle&) = delete;
+
+  coll_exec_handle(coll_exec_handle&& ch)
+    : h_(ch.h_), retval_(std::move(ch.retval_)), valid_(ch.valid_) { ch.valid_ = false; }
+  coll_exec_handle& operator=(coll_exec_handle&& ch) {
+    ITYR_CHECK(!valid_);
+    h_      = ch.h_;
+    retval_ = std::move(ch.retval_);
+    valid_  = ch.valid_;
+    ch.valid_ = false;
+    return *this;
+  }
+
+  ~coll_exec_handle() { ITYR_CHECK(!valid_); }
+
+  bool valid() const { return valid_; }
+
+  T wait() {
+    ITYR_CHECK(valid_);
+    instance::get().sched().coll_exec_wait(h_);
+    valid_ = false;
+    if constexpr (!std::is_void_v<T>) {
+      return std::move(retval_);
+    }
+  }
+
+private:
+  scheduler::coll_task_handle h_;
+  retval_t                    retval_;
+  bool                        valid_ = false;
+};
+
 }
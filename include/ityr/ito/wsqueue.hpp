@@ -5,6 +5,7 @@
 #include <memory>
 #include <type_traits>
 #include <algorithm>
+#include <limits>
 
 #include "ityr/common/util.hpp"
 #include "ityr/common/mpi_util.hpp"
@@ -21,6 +22,10 @@ public:
   const char* what() const noexcept override { return "Work stealing queue is full."; }
 };
 
+// Each queue consists of a chain of segments. The first segment of `n_entries` entries is
+// allocated in a static MPI window, and the queue grows on demand by attaching a new segment
+// to a dynamic MPI window, each of which doubles the queue capacity. The addresses of the
+// additional segments are exposed to other processes through a segment table.
 template <typename Entry, bool EnablePass = true>
 class wsqueue {
 public:
@@ -30,31 +35,53 @@ public:
       initial_pos_(EnablePass ? n_entries / 2 : 0),
       queue_state_win_(common::topology::mpicomm(), n_queues_ * 2, initial_pos_),
       entries_win_(common::topology::mpicomm(), n_entries_ * n_queues_),
+      segment_table_win_(common::topology::mpicomm(), n_queues_ * max_segments, uintptr_t(0)),
+      segments_(n_queues_ * max_segments),
+      segments_win_(common::topology::mpicomm()),
+      capacities_(n_queues_, n_entries_),
       queue_lock_(n_queues_),
       local_empty_(n_queues_, false) {}
 
+  ~wsqueue() {
+    for (int idx = 0; idx < n_queues_; idx++) {
+      for (int k = 1; k < max_segments; k++) {
+        if (segments_[idx * max_segments + k]) {
+          MPI_Win_detach(segments_win_.win(), segments_[idx * max_segments + k].get());
+        }
+      }
+    }
+  }
+
+  wsqueue(const wsqueue&) = delete;
+  wsqueue& operator=(const wsqueue&) = delete;
+
   void push(const Entry& entry, int idx = 0) {
     ITYR_PROFILER_RECORD(prof_event_wsqueue_push);
 
     ITYR_CHECK(idx < n_queues_);
 
     queue_state& qs = local_queue_state(idx);
-    auto entries = local_entries(idx);
 
     int t = qs.top.load(std::memory_order_relaxed);
 
-    if (t == n_entries_) {
-      queue_lock_.priolock(common::topology::my_rank(), idx);
-
+    if (t == capacities_[idx]) {
       int b = qs.base.load(std::memory_order_relaxed);
-      int offset = -(b + 1) / 2;
-      move_entries(offset, idx);
-      t += offset;
+      if (t - b >= capacities_[idx] / 2) {
+        // Grow the queue if it is at least half full
+        grow(idx);
+      } else {
+        queue_lock_.priolock(common::topology::my_rank(), idx);
 
-      queue_lock_.unlock(common::topology::my_rank(), idx);
+        int b = qs.base.load(std::memory_order_relaxed);
+        int offset = -(b + 1) / 2;
+        move_entries(offset, idx);
+        t += offset;
+
+        queue_lock_.unlock(common::topology::my_rank(), idx);
+      }
     }
 
-    entries[t] = entry;
+    local_entry(t, idx) = entry;
 
     qs.top.store(t + 1, std::memory_order_release);
 
@@ -74,14 +101,15 @@ public:
       // Move entries so that the base does not become too close to zero;
       // otherwise, remote pass operations may fail.
       // Check before the queue empty check.
+      int capacity = capacities_[idx];
       int b = qs.base.load(std::memory_order_relaxed);
-      if (b < n_entries_ / 10) {
+      if (b < capacity / 10) {
         int t = qs.top.load(std::memory_order_relaxed);
-        if (n_entries_ - t > n_entries_ / 10) {
+        if (capacity - t > capacity / 10) {
           queue_lock_.priolock(common::topology::my_rank(), idx);
 
           int t = qs.top.load(std::memory_order_relaxed);
-          int offset = (n_entries_ - t + 1) / 2;
+          int offset = (capacity - t + 1) / 2;
           move_entries(offset, idx);
 
           queue_lock_.unlock(common::topology::my_rank(), idx);
@@ -106,7 +134,6 @@ public:
     }
 
     std::optional<Entry> ret;
-    auto entries = local_entries(idx);
 
     int t = qs.top.load(std::memory_order_relaxed) - 1;
     qs.top.store(t, std::memory_order_relaxed);
@@ -116,7 +143,7 @@ public:
     int b = qs.base.load(std::memory_order_relaxed);
 
     if (b <= t) {
-      ret = entries[t];
+      ret = local_entry(t, idx);
     } else {
       qs.top.store(t + 1, std::memory_order_relaxed);
 
@@ -126,9 +153,9 @@ public:
       int b = qs.base.load(std::memory_order_relaxed);
 
       if (b < t) {
-        ret = entries[t];
+        ret = local_entry(t, idx);
       } else if (b == t) {
-        ret = entries[t];
+        ret = local_entry(t, idx);
 
         qs.top.store(initial_pos_, std::memory_order_relaxed);
         qs.base.store(initial_pos_, std::memory_order_relaxed);
@@ -168,7 +195,7 @@ public:
     int t = common::mpi_get_value<int>(target_rank, queue_state_top_disp(idx), queue_state_win_.win());
 
     if (b < t) {
-      ret = common::mpi_get_value<Entry>(target_rank, entries_disp(b, idx), entries_win_.win());
+      ret = remote_get_entry(target_rank, b, idx);
     } else {
       common::mpi_atomic_faa_value<int>(-1, target_rank, queue_state_base_disp(idx), queue_state_win_.win());
       ret = std::nullopt;
@@ -211,7 +238,7 @@ public:
       return false;
     }
 
-    common::mpi_put_value<Entry>(entry, target_rank, entries_disp(b - 1, idx), entries_win_.win());
+    remote_put_entry(entry, target_rank, b - 1, idx);
 
     common::mpi_put_value<int>(b - 1, target_rank, queue_state_base_disp(idx), queue_state_win_.win());
 
@@ -244,14 +271,12 @@ public:
       }
     }
 
-    auto entries = local_entries(idx);
-
     queue_lock_.priolock(common::topology::my_rank(), idx);
 
     int t = qs.top.load(std::memory_order_relaxed);
     int b = qs.base.load(std::memory_order_relaxed);
     for (int i = b; i < t; i++) {
-      fn(entries[i]);
+      fn(local_entry(i, idx));
     }
 
     if constexpr (!EnablePass) {
@@ -268,6 +293,11 @@ public:
     return local_queue_state(idx).size();
   }
 
+  int capacity(int idx = 0) const {
+    ITYR_CHECK(idx < n_queues_);
+    return capacities_[idx];
+  }
+
   bool empty(common::topology::rank_t target_rank, int idx = 0) const {
     ITYR_PROFILER_RECORD(prof_event_wsqueue_empty, target_rank);
 
@@ -277,6 +307,29 @@ public:
     return remote_qs.empty();
   }
 
+  // Read the entry to be stolen next without locking the queue. The result may be stale and
+  // should be used only as a hint (e.g., for choosing a victim).
+  std::optional<Entry> peek_nolock(common::topology::rank_t target_rank, int idx = 0) const {
+    ITYR_CHECK(idx < n_queues_);
+
+    auto remote_qs = common::mpi_get_value<queue_state>(target_rank, queue_state_disp(idx), queue_state_win_.win());
+    if (remote_qs.empty()) {
+      return std::nullopt;
+    }
+
+    auto [segment, offset] = segment_of(remote_qs.base.load(std::memory_order_relaxed));
+    if (segment == 0) {
+      return common::mpi_get_value<Entry>(target_rank, entries_disp(offset, idx), entries_win_.win());
+    } else {
+      // The segment may not be allocated anymore
+      auto addr = common::mpi_get_value<uintptr_t>(target_rank, segment_table_disp(segment, idx), segment_table_win_.win());
+      if (!addr) {
+        return std::nullopt;
+      }
+      return common::mpi_get_value<Entry>(target_rank, addr + offset * sizeof(Entry), segments_win_.win());
+    }
+  }
+
   template <typename Fn>
   void for_each_nonempty_queue(common::topology::rank_t target_rank,
                                int idx_begin, int idx_end, bool reverse, Fn fn) {
@@ -372,15 +425,86 @@ private:
     return queue_state_win_.local_buf()[n_queues_ + idx].value;
   }
 
-  auto local_entries(int idx) const {
-    return entries_win_.local_buf().subspan(idx * n_entries_, n_entries_);
+  std::size_t segment_table_disp(int segment, int idx) const {
+    return (idx * max_segments + segment) * sizeof(uintptr_t);
+  }
+
+  // The k-th segment (k >= 1) holds entries [n_entries_ * 2^(k-1), n_entries_ * 2^k)
+  std::pair<int, int> segment_of(int entry_num) const {
+    ITYR_CHECK(entry_num >= 0);
+    if (entry_num < n_entries_) {
+      return {0, entry_num};
+    }
+    int segment = 32 - __builtin_clz(static_cast<unsigned int>(entry_num / n_entries_));
+    return {segment, entry_num - (n_entries_ << (segment - 1))};
+  }
+
+  int segment_size(int segment) const {
+    return segment == 0 ? n_entries_ : (n_entries_ << (segment - 1));
+  }
+
+  Entry& local_entry(int entry_num, int idx) const {
+    auto [segment, offset] = segment_of(entry_num);
+    if (segment == 0) {
+      return entries_win_.local_buf()[idx * n_entries_ + offset];
+    } else {
+      ITYR_CHECK(segments_[idx * max_segments + segment]);
+      return segments_[idx * max_segments + segment][offset];
+    }
+  }
+
+  Entry remote_get_entry(common::topology::rank_t target_rank, int entry_num, int idx) const {
+    auto [segment, offset] = segment_of(entry_num);
+    if (segment == 0) {
+      return common::mpi_get_value<Entry>(target_rank, entries_disp(offset, idx), entries_win_.win());
+    } else {
+      auto addr = common::mpi_get_value<uintptr_t>(target_rank, segment_table_disp(segment, idx), segment_table_win_.win());
+      ITYR_CHECK(addr);
+      return common::mpi_get_value<Entry>(target_rank, addr + offset * sizeof(Entry), segments_win_.win());
+    }
+  }
+
+  void remote_put_entry(const Entry& entry, common::topology::rank_t target_rank, int entry_num, int idx) const {
+    auto [segment, offset] = segment_of(entry_num);
+    if (segment == 0) {
+      common::mpi_put_value<Entry>(entry, target_rank, entries_disp(offset, idx), entries_win_.win());
+    } else {
+      auto addr = common::mpi_get_value<uintptr_t>(target_rank, segment_table_disp(segment, idx), segment_table_win_.win());
+      ITYR_CHECK(addr);
+      common::mpi_put_value<Entry>(entry, target_rank, addr + offset * sizeof(Entry), segments_win_.win());
+    }
+  }
+
+  void grow(int idx) {
+    auto [segment, offset] = segment_of(capacities_[idx]);
+    ITYR_CHECK(offset == 0);
+
+    if (segment >= max_segments ||
+        capacities_[idx] > std::numeric_limits<int>::max() - segment_size(segment)) {
+      throw wsqueue_full_exception{};
+    }
+
+    int size = segment_size(segment);
+
+    // Page-aligned so that the memory registered for RMA is not shared with other objects
+    std::size_t bytes = common::round_up_pow2(size * sizeof(Entry), common::get_page_size());
+    Entry* p = reinterpret_cast<Entry*>(std::aligned_alloc(common::get_page_size(), bytes));
+    std::uninitialized_default_construct_n(p, size);
+    segment_ptr seg(p);
+
+    MPI_Win_attach(segments_win_.win(), seg.get(), bytes);
+
+    // The segment address must be visible before any entry in it is exposed by updating `top`
+    segment_table_win_.local_buf()[idx * max_segments + segment] = reinterpret_cast<uintptr_t>(seg.get());
+    segments_[idx * max_segments + segment] = std::move(seg);
+
+    capacities_[idx] += size;
   }
 
   void move_entries(int offset, int idx) {
     ITYR_CHECK(queue_lock_.is_locked(common::topology::my_rank(), idx));
 
     queue_state& qs = local_queue_state(idx);
-    auto entries = local_entries(idx);
 
     int t = qs.top.load(std::memory_order_relaxed);
     int b = qs.base.load(std::memory_order_relaxed);
@@ -390,21 +514,42 @@ private:
     int new_b = b + offset;
     int new_t = t + offset;
 
-    if (offset == 0 || new_b < 0 || n_entries_ < new_t) {
+    if (offset == 0 || new_b < 0 || capacities_[idx] < new_t) {
       throw wsqueue_full_exception{};
     }
 
-    std::move(&entries[b], &entries[t], &entries[new_b]);
+    // The source and destination regions can overlap
+    if (offset < 0) {
+      for (int i = b; i < t; i++) {
+        local_entry(i + offset, idx) = std::move(local_entry(i, idx));
+      }
+    } else {
+      for (int i = t - 1; i >= b; i--) {
+        local_entry(i + offset, idx) = std::move(local_entry(i, idx));
+      }
+    }
 
     qs.top.store(new_t, std::memory_order_relaxed);
     qs.base.store(new_b, std::memory_order_relaxed);
   }
 
+  static constexpr int max_segments = 24;
+
+  struct segment_deleter {
+    void operator()(Entry* p) const { std::free(p); }
+  };
+  using segment_ptr = std::unique_ptr<Entry[], segment_deleter>;
+
   int                                          n_entries_;
   int                                          n_queues_;
   int                                          initial_pos_;
   common::mpi_win_manager<queue_state_wrapper> queue_state_win_;
   common::mpi_win_manager<Entry>               entries_win_;
+  common::mpi_win_manager<uintptr_t>           segment_table_win_;
+  // Segments must outlive the dynamic window they are attached to
+  std::vector<segment_ptr>                     segments_;
+  common::mpi_win_manager<void>                segments_win_;
+  std::vector<int>                             capacities_;
   common::global_lock                          queue_lock_;
   std::vector<bool>                            local_empty_;
 };
@@ -434,11 +579,53 @@ ITYR_TEST_CASE("[ityr::ito::wsqueue] single queue") {
     }
   }
 
-  ITYR_SUBCASE("should throw exception when full") {
-    for (int i = 0; i < n_entries; i++) {
+  ITYR_SUBCASE("grow when full") {
+    int n_pushes = n_entries * 5;
+    for (int i = 0; i < n_pushes; i++) {
       wsq.push(i);
     }
-    ITYR_CHECK_THROWS_AS(wsq.push(n_entries), wsqueue_full_exception);
+    ITYR_CHECK(wsq.size() == n_pushes);
+    ITYR_CHECK(wsq.capacity() >= n_pushes);
+    for (int i = 0; i < n_pushes; i++) {
+      auto result = wsq.pop();
+      ITYR_CHECK(result.has_value());
+      ITYR_CHECK(*result == n_pushes - i - 1); // LIFO order
+    }
+  }
+
+  ITYR_SUBCASE("steal from grown queue") {
+    if (n_ranks == 1) return;
+
+    // Use a small queue so that entries span several segments
+    int n_entries_small = 16;
+    int n_pushes = n_entries_small * 6;
+    wsqueue<entry_t> wsq_small(n_entries_small);
+
+    for (common::topology::rank_t target_rank = 0; target_rank < n_ranks; target_rank++) {
+      ITYR_CHECK(wsq_small.empty(target_rank));
+
+      common::mpi_barrier(common::topology::mpicomm());
+
+      if (target_rank == my_rank) {
+        for (int i = 0; i < n_pushes; i++) {
+          wsq_small.push(i);
+        }
+      }
+
+      common::mpi_barrier(common::topology::mpicomm());
+
+      if ((target_rank + 1) % n_ranks == my_rank) {
+        for (int i = 0; i < n_pushes; i++) {
+          auto result = wsq_small.steal(target_rank);
+          ITYR_CHECK(result.has_value());
+          ITYR_CHECK(*result == i); // FIFO order
+        }
+      }
+
+      common::mpi_barrier(common::topology::mpicomm());
+
+      ITYR_CHECK(wsq_small.empty(target_rank));
+    }
   }
 
   ITYR_SUBCASE("steal") {
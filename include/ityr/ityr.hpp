@@ -5,6 +5,7 @@
 #include "ityr/common/topology.hpp"
 #include "ityr/common/wallclock.hpp"
 #include "ityr/common/profiler.hpp"
+#include "ityr/common/progress_thread.hpp"
 #include "ityr/ito/ito.hpp"
 #include "ityr/ori/ori.hpp"
 #include "ityr/pattern/count_iterator.hpp"
@@ -15,9 +16,14 @@
 #include "ityr/pattern/parallel_filter.hpp"
 #include "ityr/pattern/parallel_merge.hpp"
 #include "ityr/pattern/parallel_sort.hpp"
+#include "ityr/pattern/parallel_select.hpp"
+#include "ityr/pattern/parallel_histogram.hpp"
+#include "ityr/pattern/parallel_reduce_by_key.hpp"
+#include "ityr/pattern/parallel_concat.hpp"
 #include "ityr/pattern/parallel_search.hpp"
 #include "ityr/pattern/parallel_shuffle.hpp"
 #include "ityr/pattern/random.hpp"
+#include "ityr/pattern/future.hpp"
 #include "ityr/pattern/reducer_extra.hpp"
 #include "ityr/container/global_span.hpp"
 #include "ityr/container/global_vector.hpp"
@@ -43,6 +49,7 @@ private:
   common::singleton_initializer<common::topology::instance>  topo_;
   common::singleton_initializer<common::wallclock::instance> clock_;
   common::singleton_initializer<common::profiler::instance>  prof_;
+  common::singleton_initializer<common::progress_thread::instance> progress_thread_;
   common::singleton_initializer<ito::instance>               ito_;
   common::singleton_initializer<ori::instance>               ori_;
 };
@@ -124,7 +131,17 @@ inline bool is_root() {
 }
 
 /**
- * @brief Migrate the current thread to `target_rank`. For the root thread only.
+ * @brief Migrate the current thread to `target_rank`.
+ *
+ * Any thread can be migrated (only the root thread with the ADWS scheduler). Combined with
+ * `ityr::ori::get_owner()`, this enables owner-computes scheduling, in which a thread moves to
+ * the data it is about to process instead of fetching the data through the cache.
+ *
+ * Example:
+ * ```
+ * ityr::migrate_to(ityr::ori::get_owner(p));
+ * // process data pointed by `p` locally
+ * ```
  */
 inline void migrate_to(rank_t target_rank) {
   ito::migrate_to(target_rank, [] { ori::release(); }, [] { ori::acquire(); });
@@ -396,6 +413,26 @@ inline void profiler_flush() {
    });
 }
 
+/**
+ * @brief Print the call stack usage of each process to stdout (collective).
+ *
+ * The high-water mark is the maximum depth of the call stack used so far on each process,
+ * which helps to choose the stack size (`ITYR_ITO_STACK_SIZE`). A stack overflow is reported
+ * when it runs into the guard region (`ITYR_ITO_STACK_GUARD_SIZE`) below the stack.
+ */
+inline void print_stack_usage() {
+  ITYR_CHECK(is_spmd());
+  auto hwms = common::mpi_allgather_value(ito::stack_high_water_mark(), common::topology::mpicomm());
+  if (is_master()) {
+    std::size_t stack_size = ito::stack_size_option::value();
+    for (rank_t i = 0; i < n_ranks(); i++) {
+      printf("stack high-water mark (rank %d): %lu / %lu bytes (%.1f %%)\n",
+             i, hwms[i], stack_size, 100.0 * hwms[i] / stack_size);
+    }
+    fflush(stdout);
+  }
+}
+
 /**
  * @brief Print the compile-time options to stdout.
  * @see `ityr::print_runtime_options()`.
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <algorithm>
+#include <vector>
 
 #include "ityr/common/util.hpp"
 #include "ityr/common/mpi_util.hpp"
@@ -58,6 +59,41 @@ void for_each_seg_blk(const coll_mem& cm, void* addr, std::size_t size,
   });
 }
 
+// Issues element-wise atomic adds directly to the home of global memory, bypassing the cache.
+// `win_fn(win)` is called for each RMA window used, which should be flushed to complete the adds.
+template <typename T, typename WinFn>
+void atomic_add_home_nb(coll_mem_manager& cm_manager, noncoll_mem& noncoll_mem,
+                        const T* from_addr, T* to_addr, std::size_t count, WinFn win_fn) {
+  std::byte* to_addr_ = reinterpret_cast<std::byte*>(to_addr);
+  std::size_t size    = sizeof(T) * count;
+
+  // MPI atomics are used even for the memory in the same node, as they are not atomic with
+  // respect to direct memory accesses
+  if (noncoll_mem.has(to_addr_)) {
+    common::rma::atomic_add_nb(from_addr, count, noncoll_mem.win(),
+                               noncoll_mem.get_owner(to_addr_), noncoll_mem.get_disp(to_addr_));
+    win_fn(noncoll_mem.win());
+    return;
+  }
+
+  coll_mem& cm = cm_manager.get(to_addr_);
+
+  for_each_mem_segment(cm, to_addr_, size, [&](const auto& seg) {
+    std::byte* seg_addr   = reinterpret_cast<std::byte*>(cm.vm().addr()) + seg.offset_b;
+    std::byte* seg_addr_b = std::max(seg_addr, to_addr_);
+    std::byte* seg_addr_e = std::min(reinterpret_cast<std::byte*>(cm.vm().addr()) + seg.offset_e,
+                                     to_addr_ + size);
+    ITYR_CHECK((seg_addr_b - to_addr_) % sizeof(T) == 0);
+    ITYR_CHECK((seg_addr_e - seg_addr_b) % sizeof(T) == 0);
+    common::rma::atomic_add_nb(from_addr + (seg_addr_b - to_addr_) / sizeof(T),
+                               (seg_addr_e - seg_addr_b) / sizeof(T),
+                               cm.win(), common::topology::inter2global_rank(seg.owner),
+                               seg.pm_offset + (seg_addr_b - seg_addr));
+  });
+
+  win_fn(cm.win());
+}
+
 template <block_size_t BlockSize>
 class core_default {
   static constexpr bool enable_vm_map = ITYR_ORI_ENABLE_VM_MAP;
@@ -201,6 +237,22 @@ public:
     }
   }
 
+  template <typename T>
+  void atomic_add_nb(const T* from_addr, T* to_addr, std::size_t count) {
+    atomic_add_home_nb(cm_manager_, noncoll_mem_, from_addr, to_addr, count, [&](const common::rma::win& win) {
+      if (std::find(atomic_wins_.begin(), atomic_wins_.end(), &win) == atomic_wins_.end()) {
+        atomic_wins_.push_back(&win);
+      }
+    });
+  }
+
+  void atomic_complete() {
+    for (const common::rma::win* win : atomic_wins_) {
+      common::rma::flush(*win);
+    }
+    atomic_wins_.clear();
+  }
+
   template <typename Mode>
   bool checkout_nb(void* addr, std::size_t size, Mode) {
     if constexpr (!enable_vm_map) {
@@ -317,6 +369,23 @@ public:
     cache_manager_.cache_prof_print();
   }
 
+  common::topology::rank_t get_owner(void* addr) {
+    if (noncoll_mem_.has(addr)) {
+      return noncoll_mem_.get_owner(addr);
+    }
+
+    coll_mem& cm = cm_manager_.get(addr);
+    std::size_t offset = reinterpret_cast<std::byte*>(addr) - reinterpret_cast<std::byte*>(cm.vm().addr());
+    auto seg = cm.mem_mapper().get_segment(offset);
+
+    // The home segment is directly accessible from all processes in the owner node
+    if (seg.owner == common::topology::inter_my_rank()) {
+      return common::topology::my_rank();
+    } else {
+      return common::topology::inter2global_rank(seg.owner);
+    }
+  }
+
   /* APIs for debugging */
 
   void* get_local_mem(void* addr) {
@@ -607,6 +676,8 @@ private:
   noncoll_mem              noncoll_mem_;
   home_manager<BlockSize>  home_manager_;
   cache_manager<BlockSize> cache_manager_;
+
+  std::vector<const common::rma::win*> atomic_wins_;
 };
 
 template <block_size_t BlockSize>
@@ -697,6 +768,22 @@ public:
     put_impl(reinterpret_cast<const std::byte*>(from_addr), to_addr_, size);
   }
 
+  template <typename T>
+  void atomic_add_nb(const T* from_addr, T* to_addr, std::size_t count) {
+    atomic_add_home_nb(cm_manager_, noncoll_mem_, from_addr, to_addr, count, [&](const common::rma::win& win) {
+      if (std::find(atomic_wins_.begin(), atomic_wins_.end(), &win) == atomic_wins_.end()) {
+        atomic_wins_.push_back(&win);
+      }
+    });
+  }
+
+  void atomic_complete() {
+    for (const common::rma::win* win : atomic_wins_) {
+      common::rma::flush(*win);
+    }
+    atomic_wins_.clear();
+  }
+
   template <typename Mode>
   bool checkout_nb(void*, std::size_t, Mode) {
     common::die("core::checkout/checkin is disabled");
@@ -739,6 +826,23 @@ public:
   void cache_prof_end() {}
   void cache_prof_print() const {}
 
+  common::topology::rank_t get_owner(void* addr) {
+    if (noncoll_mem_.has(addr)) {
+      return noncoll_mem_.get_owner(addr);
+    }
+
+    coll_mem& cm = cm_manager_.get(addr);
+    std::size_t offset = reinterpret_cast<std::byte*>(addr) - reinterpret_cast<std::byte*>(cm.vm().addr());
+    auto seg = cm.mem_mapper().get_segment(offset);
+
+    // The home segment is directly accessible from all processes in the owner node
+    if (seg.owner == common::topology::inter_my_rank()) {
+      return common::topology::my_rank();
+    } else {
+      return common::topology::inter2global_rank(seg.owner);
+    }
+  }
+
   /* APIs for debugging */
 
   void* get_local_mem(void* addr) {
@@ -874,6 +978,8 @@ private:
 
   coll_mem_manager cm_manager_;
   noncoll_mem      noncoll_mem_;
+
+  std::vector<const common::rma::win*> atomic_wins_;
 };
 
 template <block_size_t BlockSize>
@@ -910,6 +1016,15 @@ public:
     std::memcpy(to_addr, from_addr, size);
   }
 
+  template <typename T>
+  void atomic_add_nb(const T* from_addr, T* to_addr, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+      to_addr[i] += from_addr[i];
+    }
+  }
+
+  void atomic_complete() {}
+
   template <typename Mode>
   bool checkout_nb(void*, std::size_t, Mode) { return true; }
 
@@ -942,6 +1057,8 @@ public:
   void cache_prof_end() {}
   void cache_prof_print() const {}
 
+  common::topology::rank_t get_owner(void*) { return 0; }
+
   /* APIs for debugging */
 
   void* get_local_mem(void* addr) { return addr; }
@@ -978,6 +1095,22 @@ ITYR_TEST_CASE("[ityr::ori::core] malloc/free with block policy") {
       c.free_coll(ptrs[i]);
     }
   }
+
+  ITYR_SUBCASE("owner") {
+    auto n_inter_ranks = common::topology::inter_n_ranks();
+    auto p = reinterpret_cast<std::byte*>(c.malloc_coll<mem_mapper::block>(n_inter_ranks * bs));
+    for (int i = 0; i < n_inter_ranks; i++) {
+      auto expected = (i == common::topology::inter_my_rank()) ?
+                      common::topology::my_rank() : common::topology::inter2global_rank(i);
+      ITYR_CHECK(c.get_owner(p + i * bs) == expected);
+      ITYR_CHECK(c.get_owner(p + (i + 1) * bs - 1) == expected);
+    }
+    c.free_coll(p);
+
+    void* q = c.malloc(16);
+    ITYR_CHECK(c.get_owner(q) == common::topology::my_rank());
+    c.free(q, 16);
+  }
 }
 
 ITYR_TEST_CASE("[ityr::ori::core] malloc/free with cyclic policy") {
@@ -1139,6 +1272,77 @@ ITYR_TEST_CASE("[ityr::ori::core] get/put") {
   c.free_coll(ps[1]);
 }
 
+ITYR_TEST_CASE("[ityr::ori::core] atomic add") {
+  common::runtime_options common_opts;
+  runtime_options opts;
+  common::singleton_initializer<common::topology::instance> topo;
+  common::singleton_initializer<common::rma::instance> rma;
+  constexpr block_size_t bs = 65536;
+  int n_cb = 16;
+  core<bs> c(n_cb * bs, bs / 4);
+
+  auto my_rank = common::topology::my_rank();
+  auto n_ranks = common::topology::n_ranks();
+
+  std::size_t n = n_cb * bs / 4 / sizeof(std::size_t);
+
+  std::size_t* ps[3];
+  ps[0] = reinterpret_cast<std::size_t*>(c.malloc_coll<mem_mapper::block >(n * sizeof(std::size_t)));
+  ps[1] = reinterpret_cast<std::size_t*>(c.malloc_coll<mem_mapper::cyclic>(n * sizeof(std::size_t)));
+  ps[2] = nullptr;
+  if (my_rank == 0) {
+    ps[2] = reinterpret_cast<std::size_t*>(c.malloc(n * sizeof(std::size_t)));
+  }
+  ps[2] = common::mpi_bcast_value(ps[2], 0, common::topology::mpicomm());
+
+  std::size_t* buf = new std::size_t[n];
+  for (std::size_t i = 0; i < n; i++) {
+    buf[i] = i;
+  }
+
+  auto barrier = [&]() {
+    c.release();
+    common::mpi_barrier(common::topology::mpicomm());
+    c.acquire();
+  };
+
+  for (auto p : ps) {
+    if (my_rank == 0) {
+      std::vector<std::size_t> zeros(n, 0);
+      c.put(zeros.data(), p, n * sizeof(std::size_t));
+    }
+
+    barrier();
+
+    // each process adds to the range shifted by its rank, so that the ranges cross segment boundaries
+    std::size_t ib = my_rank;
+    std::size_t ie = n - n_ranks + my_rank;
+    c.atomic_add_nb(buf + ib, p + ib, ie - ib);
+    c.atomic_complete();
+
+    barrier();
+
+    std::vector<std::size_t> result(n);
+    c.get(p, result.data(), n * sizeof(std::size_t));
+
+    for (std::size_t i = 0; i < n; i++) {
+      std::size_t n_added = std::min<std::size_t>(i + 1, n_ranks) -
+                            (i + n_ranks >= n ? i + n_ranks - n + 1 : 0);
+      ITYR_CHECK(result[i] == i * n_added);
+    }
+
+    barrier();
+  }
+
+  delete[] buf;
+
+  c.free_coll(ps[0]);
+  c.free_coll(ps[1]);
+  if (my_rank == 0) {
+    c.free(ps[2], n * sizeof(std::size_t));
+  }
+}
+
 ITYR_TEST_CASE("[ityr::ori::core] checkout/checkin (small, aligned)") {
   common::runtime_options common_opts;
   runtime_options opts;
@@ -2,6 +2,7 @@
 
 #include "ityr/common/util.hpp"
 #include "ityr/common/options.hpp"
+#include "ityr/common/topology.hpp"
 
 namespace ityr::ori {
 
@@ -57,10 +58,28 @@ inline void print_compile_options() {
   ITYR_PRINT_MACRO(ITYR_ORI_HOME_TLB_SIZE);
 }
 
+// If set (nonzero), the cache size for each process is determined by evenly dividing this size
+// among the processes on the same node (sharing memory), unless ITYR_ORI_CACHE_SIZE is explicitly given
+struct cache_size_per_node_option : public common::option<cache_size_per_node_option, std::size_t> {
+  using option::option;
+  static std::string name() { return "ITYR_ORI_CACHE_SIZE_PER_NODE"; }
+  static std::size_t default_value() { return 0; }
+};
+
 struct cache_size_option : public common::option<cache_size_option, std::size_t> {
   using option::option;
   static std::string name() { return "ITYR_ORI_CACHE_SIZE"; }
-  static std::size_t default_value() { return std::size_t(16) * 1024 * 1024; }
+  static std::size_t default_value() {
+    std::size_t per_node = cache_size_per_node_option::value();
+    if (per_node == 0) {
+      return std::size_t(16) * 1024 * 1024;
+    }
+    // The cache size must be a power of two and hold at least one block
+    std::size_t s = per_node / common::topology::intra_n_ranks();
+    std::size_t s_pow2 = common::next_pow2(s);
+    if (s_pow2 != s) s_pow2 /= 2;
+    return std::max(s_pow2, std::size_t(ITYR_ORI_BLOCK_SIZE));
+  }
 };
 
 struct sub_block_size_option : public common::option<sub_block_size_option, std::size_t> {
@@ -94,6 +113,7 @@ struct lazy_release_make_mpi_progress_option : public common::option<lazy_releas
 };
 
 struct runtime_options {
+  common::option_initializer<cache_size_per_node_option>            ITYR_ANON_VAR;
   common::option_initializer<cache_size_option>                     ITYR_ANON_VAR;
   common::option_initializer<sub_block_size_option>                 ITYR_ANON_VAR;
   common::option_initializer<max_dirty_cache_size_option>           ITYR_ANON_VAR;
@@ -5,6 +5,7 @@
 #include "ityr/common/topology.hpp"
 #include "ityr/common/wallclock.hpp"
 #include "ityr/common/profiler.hpp"
+#include "ityr/common/progress_thread.hpp"
 #include "ityr/common/prof_events.hpp"
 #include "ityr/common/rma.hpp"
 #include "ityr/ori/util.hpp"
@@ -32,6 +33,7 @@ private:
   common::singleton_initializer<common::wallclock::instance> clock_;
   common::singleton_initializer<common::profiler::instance>  prof_;
   common::singleton_initializer<common::rma::instance>       rma_;
+  common::singleton_initializer<common::progress_thread::instance> progress_thread_;
   common::prof_events                                        common_prof_events_;
 
   runtime_options                                            ori_opts_;
@@ -90,6 +92,26 @@ inline void put(const T* from_ptr, global_ptr<T> to_ptr, std::size_t count) {
   core::instance::get().put(from_ptr, to_ptr.raw_ptr(), count * sizeof(T));
 }
 
+// Atomically adds `from_ptr[i]` to `to_ptr[i]` for each `i` in [0, `count`) at the home of the global
+// memory (bypassing the cache). The adds are completed by `atomic_complete()`, until which `from_ptr`
+// must not be modified. The target region must not be checked out or cached dirty concurrently.
+template <typename T>
+inline void atomic_add_nb(const T* from_ptr, global_ptr<T> to_ptr, std::size_t count) {
+  static_assert(std::is_arithmetic_v<T>, "Atomic add requires arithmetic types");
+  core::instance::get().atomic_add_nb(from_ptr, to_ptr.raw_ptr(), count);
+}
+
+inline void atomic_complete() {
+  core::instance::get().atomic_complete();
+}
+
+// Returns a process that can access the global memory pointed by `ptr` without caching
+// (this process if the memory is in the same node)
+template <typename T>
+inline common::topology::rank_t get_owner(global_ptr<T> ptr) {
+  return core::instance::get().get_owner(const_cast<std::remove_const_t<T>*>(ptr.raw_ptr()));
+}
+
 inline constexpr bool force_getput = ITYR_ORI_FORCE_GETPUT;
 
 template <bool SkipFetch, typename T>
@@ -19,10 +19,31 @@ struct sequenced_policy {
    */
   std::size_t checkout_count = 1;
 
+  /**
+   * @brief The number of chunks (of `checkout_count` elements) to be checked out ahead.
+   *
+   * If nonzero, the checkout for the chunk `pipeline_depth` chunks ahead is issued before the
+   * current chunk is processed, so that the communication overlaps with the computation.
+   * Up to `pipeline_depth + 1` chunks are checked out at the same time, which must fit in the cache.
+   */
+  std::size_t pipeline_depth = 0;
+
   constexpr sequenced_policy() noexcept {}
 
   constexpr sequenced_policy(std::size_t checkout_count) noexcept
     : checkout_count(checkout_count) {}
+
+  constexpr sequenced_policy(std::size_t checkout_count, std::size_t pipeline_depth) noexcept
+    : checkout_count(checkout_count), pipeline_depth(pipeline_depth) {}
+
+  /**
+   * @brief Return a copy of this policy with the given pipeline depth for automatic checkout.
+   */
+  constexpr sequenced_policy with_pipeline_depth(std::size_t depth) const noexcept {
+    sequenced_policy p = *this;
+    p.pipeline_depth = depth;
+    return p;
+  }
 };
 
 /**
@@ -74,6 +95,97 @@ struct parallel_policy {
    * @brief Work hints for ADWS.
    */
   workhint_range_view<W> workhint;
+
+  /**
+   * @brief Fork policy for child tasks (work-first by default).
+   *
+   * With `ito::fork_policy::help_first`, child tasks are pushed to the task queue as closures,
+   * and no call stack is copied when they are stolen. This is supported only by the
+   * `randws` scheduler and falls back to work-first forking in other schedulers.
+   */
+  ito::fork_policy fork_policy = ito::fork_policy::work_first;
+
+  /**
+   * @brief Enable automatic granularity control by lazy binary splitting.
+   *
+   * If enabled, loops are not split eagerly down to `cutoff_count` elements. Instead, each task
+   * processes its range serially in chunks of `checkout_count` elements and splits the rest of
+   * the range in half only when the scheduler reports demand for parallelism (e.g., the local
+   * task queue is empty). `cutoff_count` is still the minimum number of elements to be split.
+   */
+  bool lazy_split = false;
+
+  /**
+   * @brief Learn work hints from the measured execution time of leaf tasks.
+   *
+   * If enabled, the execution time of the serial leaf work under each node of the given work
+   * hint tree (`workhint`) is measured, and the node is overwritten with the measured costs of
+   * its left and right halves after the loop finishes. Reusing the same `ityr::workhint_range`
+   * in subsequent executions of the same loop thus distributes the work according to the costs
+   * observed in the previous execution. Only effective for ADWS with a non-void work hint type.
+   */
+  bool learn_workhint = false;
+
+  /**
+   * @brief The number of chunks to be checked out ahead in leaf tasks.
+   * @see `ityr::execution::sequenced_policy::pipeline_depth`
+   */
+  std::size_t pipeline_depth = 0;
+
+  /**
+   * @brief Use distributed sample sort in `ityr::sort()`.
+   *
+   * If enabled, `ityr::sort()` for global pointers distributes elements to buckets by sampled
+   * splitters and sorts each bucket independently, instead of recursive merge sort.
+   * Each element is moved across processes only twice (to a bucket and back to the range),
+   * regardless of the size of the range. Ignored by other functions.
+   */
+  bool sample_sort = false;
+
+  /**
+   * @brief Return a copy of this policy with the given fork policy.
+   */
+  constexpr parallel_policy with_fork_policy(ito::fork_policy fp) const noexcept {
+    parallel_policy p = *this;
+    p.fork_policy = fp;
+    return p;
+  }
+
+  /**
+   * @brief Return a copy of this policy with lazy binary splitting enabled or disabled.
+   */
+  constexpr parallel_policy with_lazy_split(bool enabled = true) const noexcept {
+    parallel_policy p = *this;
+    p.lazy_split = enabled;
+    return p;
+  }
+
+  /**
+   * @brief Return a copy of this policy with work hint learning enabled or disabled.
+   */
+  constexpr parallel_policy with_workhint_learning(bool enabled = true) const noexcept {
+    parallel_policy p = *this;
+    p.learn_workhint = enabled;
+    return p;
+  }
+
+  /**
+   * @brief Return a copy of this policy with the given pipeline depth for automatic checkout.
+   */
+  constexpr parallel_policy with_pipeline_depth(std::size_t depth) const noexcept {
+    parallel_policy p = *this;
+    p.pipeline_depth = depth;
+    return p;
+  }
+
+  /**
+   * @brief Return a copy of this policy with sample sort enabled or disabled.
+   */
+  constexpr parallel_policy with_sample_sort(bool enabled = true) const noexcept {
+    parallel_policy p = *this;
+    p.sample_sort = enabled;
+    return p;
+  }
 };
 
 /**
@@ -88,6 +200,18 @@ inline constexpr sequenced_policy seq;
  */
 inline constexpr parallel_policy par;
 
+/**
+ * @brief Default parallel execution policy with automatic granularity control.
+ * @see `ityr::execution::parallel_policy::lazy_split`
+ */
+inline constexpr parallel_policy par_auto = parallel_policy<>().with_lazy_split();
+
+/**
+ * @brief Default parallel execution policy with sample sort for `ityr::sort()`.
+ * @see `ityr::execution::parallel_policy::sample_sort`
+ */
+inline constexpr parallel_policy par_sample = parallel_policy<>().with_sample_sort();
+
 namespace internal {
 
 inline constexpr sequenced_policy to_sequenced_policy(const sequenced_policy& policy) noexcept {
@@ -96,7 +220,7 @@ inline constexpr sequenced_policy to_sequenced_policy(const sequenced_policy& po
 
 template <typename W>
 inline constexpr sequenced_policy to_sequenced_policy(const parallel_policy<W>& policy) noexcept {
-  return sequenced_policy(policy.checkout_count);
+  return sequenced_policy(policy.checkout_count, policy.pipeline_depth);
 }
 
 inline void assert_policy(const sequenced_policy& policy) {
@@ -123,6 +247,33 @@ inline auto get_workhint(const parallel_policy<W>& policy) {
   }
 }
 
+template <typename W, typename Fn>
+inline double measure_cost(const parallel_policy<W>& policy, Fn&& fn) {
+  if (policy.learn_workhint) {
+    auto t0 = common::clock_gettime_ns();
+    std::forward<Fn>(fn)();
+    return static_cast<double>(common::clock_gettime_ns() - t0);
+  } else {
+    std::forward<Fn>(fn)();
+    return 0;
+  }
+}
+
+template <typename W>
+inline void set_learned_workhint(const parallel_policy<W>& policy, double c1, double c2) {
+  if constexpr (!std::is_void_v<W>) {
+    if (policy.learn_workhint && !policy.workhint.empty()) {
+      W w1 = static_cast<W>(c1);
+      W w2 = static_cast<W>(c2);
+      // Keep the previous hint if no cost was observed (ADWS requires w1 + w2 > 0)
+      if (w1 + w2 > W(0)) {
+        workhint_range_view<W> wh = policy.workhint;
+        wh.set_workhint(w1, w2);
+      }
+    }
+  }
+}
+
 template <typename W>
 inline auto get_child_policies(const parallel_policy<W>& policy) {
   if constexpr (std::is_void_v<W>) {
@@ -131,12 +282,16 @@ inline auto get_child_policies(const parallel_policy<W>& policy) {
     if (policy.workhint.empty()) {
       return std::make_pair(policy, policy);
     } else if (!policy.workhint.has_children()) {
-      return std::make_pair(parallel_policy<W>(policy.cutoff_count, policy.checkout_count),
-                            parallel_policy<W>(policy.cutoff_count, policy.checkout_count));
+      parallel_policy<W> p = policy;
+      p.workhint = {};
+      return std::make_pair(p, p);
     } else {
       auto [c1, c2] = policy.workhint.get_children();
-      return std::make_pair(parallel_policy(policy.cutoff_count, policy.checkout_count, c1),
-                            parallel_policy(policy.cutoff_count, policy.checkout_count, c2));
+      parallel_policy<W> p1 = policy;
+      parallel_policy<W> p2 = policy;
+      p1.workhint = c1;
+      p2.workhint = c2;
+      return std::make_pair(p1, p2);
     }
   }
 }
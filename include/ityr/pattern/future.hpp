@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+
+#include "ityr/common/util.hpp"
+#include "ityr/ito/ito.hpp"
+#include "ityr/ori/ori.hpp"
+#include "ityr/pattern/root_exec.hpp"
+
+namespace ityr {
+
+/**
+ * @brief A handle to the result of an asynchronous task.
+ *
+ * @tparam T Type of the result (must be trivially copyable or `void`).
+ *
+ * Unlike fork/join tasks (e.g., `ityr::parallel_invoke()`), futures are not strictly nested:
+ * a future can be copied, passed to other tasks, and waited for by any number of tasks.
+ * This enables irregular dependencies such as wavefront and pipeline computations.
+ *
+ * Futures are created by `ityr::async()`, `ityr::future::then()`, or `ityr::when_all()`.
+ * Global memory updated by the asynchronous task is visible to the tasks that obtained its result
+ * by `get()`.
+ *
+ * @see `ityr::async()`
+ */
+template <typename T>
+class future {
+public:
+  using value_type = T;
+
+  future() {}
+  explicit future(ito::future<T>&& f) : f_(std::move(f)) {}
+
+  /**
+   * @brief Returns true if the future refers to an asynchronous task.
+   */
+  bool valid() const { return f_.valid(); }
+
+  /**
+   * @brief Returns true if the result is available (`get()` does not block).
+   */
+  bool ready() const { return f_.ready(); }
+
+  /**
+   * @brief Wait for the asynchronous task to be completed and get its result.
+   *
+   * The current thread can be suspended and resumed by another process.
+   * Unlike `std::future`, `get()` can be called multiple times (like `std::shared_future`).
+   */
+  T get() const {
+    if constexpr (std::is_void_v<T>) {
+      f_.get();
+      ori::acquire();
+    } else {
+      T ret = f_.get();
+      ori::acquire();
+      return ret;
+    }
+  }
+
+  /**
+   * @brief Create a future that calls `fn` with the result of this future.
+   *
+   * @param fn Function object called with the result of this future (or with no argument if `T` is void).
+   *
+   * @return A future for the result of `fn`.
+   *
+   * This future remains valid.
+   */
+  template <typename Fn>
+  auto then(Fn&& fn) const;
+
+private:
+  ito::future<T> f_;
+};
+
+/**
+ * @brief Run a function asynchronously and get a future for its result.
+ *
+ * @param fn      Function object to be executed asynchronously.
+ * @param args... Arguments to be passed to `fn` (optional).
+ *
+ * @return A future (`ityr::future`) for the result of `fn(args...)`.
+ *
+ * The task is forked as with `ityr::parallel_invoke()`, but it is not joined by the caller;
+ * its result can be obtained by any task holding a copy of the returned future.
+ * The result type must be trivially copyable (or void).
+ *
+ * Example:
+ * ```
+ * ityr::future<int> f = ityr::async([] { return 1; });
+ * ityr::future<int> g = f.then([](int x) { return x + 1; });
+ * ityr::parallel_invoke([=] { f.get(); }, [=] { g.get(); });
+ * ```
+ *
+ * @see `ityr::future`, `ityr::when_all()`
+ */
+template <typename Fn, typename... Args>
+inline auto async(Fn&& fn, Args&&... args) {
+  using retval_t = std::invoke_result_t<Fn, Args...>;
+
+  ori::poll();
+
+  auto rh = ori::release_lazy();
+
+  // The release at the end of the task is needed even if the task is serialized, because
+  // waiters can be other tasks on any process
+  return future<retval_t>(
+      ito::async(ito::with_callback, [rh] { ori::acquire(rh); }, [] { ori::release(); },
+                 std::forward<Fn>(fn), std::forward<Args>(args)...));
+}
+
+template <typename T>
+template <typename Fn>
+inline auto future<T>::then(Fn&& fn) const {
+  ITYR_CHECK(valid());
+  return async([f = *this, fn = std::forward<Fn>(fn)]() mutable {
+    if constexpr (std::is_void_v<T>) {
+      f.get();
+      return fn();
+    } else {
+      return fn(f.get());
+    }
+  });
+}
+
+/**
+ * @brief Create a future that is completed when all of the given futures are completed.
+ *
+ * @param fs... Futures to be waited for.
+ *
+ * @return A future of type `ityr::future<void>`.
+ *
+ * The given futures remain valid and their results can be obtained by `get()` after the returned
+ * future is completed.
+ *
+ * @see `ityr::future`
+ */
+template <typename... Ts>
+inline future<void> when_all(const future<Ts>&... fs) {
+  return async([=] { (fs.get(), ...); });
+}
+
+ITYR_TEST_CASE("[ityr::pattern::future] async and get") {
+  ito::init();
+  ori::init();
+
+  ito::root_exec([=] {
+    future<int> f = async([] { return 1; });
+    future<int> g = async([](int x, int y) { return x * y; }, 3, 4);
+    future<void> h = async([] {});
+    ITYR_CHECK(f.get() == 1);
+    ITYR_CHECK(g.get() == 12);
+    ITYR_CHECK(f.get() == 1);
+    h.get();
+    ITYR_CHECK(f.ready());
+    ITYR_CHECK(h.ready());
+
+    future<int> i;
+    ITYR_CHECK(!i.valid());
+    i = f;
+    ITYR_CHECK(i.valid());
+    ITYR_CHECK(i.get() == 1);
+  });
+
+  ori::fini();
+  ito::fini();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::future] then and when_all") {
+  ito::init();
+  ori::init();
+
+  ito::root_exec([=] {
+    future<int> f = async([] { return 2; });
+    future<long> g = f.then([](int x) { return long(x) * 3; });
+    future<void> h = g.then([](long) {});
+    future<int> i = h.then([] { return 5; });
+    ITYR_CHECK(g.get() == 6);
+    ITYR_CHECK(i.get() == 5);
+
+    when_all(f, g, h, i).get();
+    ITYR_CHECK(f.ready());
+    ITYR_CHECK(g.ready());
+    ITYR_CHECK(h.ready());
+    ITYR_CHECK(i.ready());
+  });
+
+  ito::root_exec([=] {
+    // A chain of global memory updates ordered only by futures
+    ori::global_ptr<long> p = ori::malloc<long>(1);
+    *p = 0;
+
+    constexpr int n = 32;
+    future<void> f = async([=] { *p = 1; });
+    for (int k = 1; k < n; k++) {
+      f = f.then([=] { *p += k + 1; });
+    }
+    f.get();
+    ITYR_CHECK(long(*p) == n * (n + 1) / 2);
+
+    ori::free(p, 1);
+  });
+
+  ori::fini();
+  ito::fini();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::future] requests in independent root threads") {
+  ito::init();
+  ori::init();
+
+  constexpr int n_reqs = 16;
+
+  auto my_rank = common::topology::my_rank();
+  auto n_ranks = common::topology::n_ranks();
+
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n_ranks * n_reqs);
+
+  long r = root_exec_each([=] {
+    // Each request is processed asynchronously and has its own completion handle
+    std::array<future<long>, n_reqs> fs;
+    for (int i = 0; i < n_reqs; i++) {
+      long id = my_rank * n_reqs + i;
+      fs[i] = async([=] {
+        p[id] = id;
+        return id;
+      });
+    }
+    long sum = 0;
+    for (auto&& f : fs) {
+      sum += f.get();
+    }
+    return sum;
+  });
+
+  ITYR_CHECK(r == long(my_rank) * n_reqs * n_reqs + n_reqs * (n_reqs - 1) / 2);
+
+  root_exec([=] {
+    for (long i = 0; i < n_ranks * n_reqs; i++) {
+      ITYR_CHECK(long(p[i]) == i);
+    }
+  });
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::future] wavefront") {
+  ito::init();
+  ori::init();
+
+  constexpr int n = 8;
+
+  long r = ito::root_exec([=] {
+    // f[i][j] depends on f[i-1][j] and f[i][j-1]; no task group can express this without
+    // synchronizing the whole diagonal
+    std::array<std::array<future<long>, n>, n> f;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        if (i == 0 || j == 0) {
+          f[i][j] = async([] { return 1L; });
+        } else {
+          f[i][j] = async([up = f[i - 1][j], left = f[i][j - 1]] {
+            return up.get() + left.get();
+          });
+        }
+      }
+    }
+    return f[n - 1][n - 1].get();
+  });
+
+  ITYR_CHECK(r == 3432); // C(14, 7)
+
+  ori::fini();
+  ito::fini();
+}
+
+}
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <vector>
+
+#include "ityr/common/util.hpp"
+#include "ityr/pattern/count_iterator.hpp"
+#include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_reduce.hpp"
+#include "ityr/pattern/reducer_extra.hpp"
+#include "ityr/container/global_vector.hpp"
+#include "ityr/container/checkout_span.hpp"
+
+namespace ityr {
+
+namespace internal {
+
+template <typename CountOp, typename ForwardIterator>
+inline std::size_t concat_count(const execution::sequenced_policy& policy,
+                                CountOp                            count_op,
+                                ForwardIterator                    first,
+                                ForwardIterator                    last) {
+  std::size_t c = 0;
+  for_each_aux(
+      policy,
+      [&](auto&& x) { c += count_op(x); },
+      first, last);
+  return c;
+}
+
+// Generates the outputs of elements in [first, last) into the output range beginning at `first_d`.
+// Consecutive elements are grouped so that each checkout of the output range is at most
+// `checkout_count` elements (unless a single element generates more).
+template <typename CountOp, typename GenerateOp, typename ForwardIterator, typename T>
+inline void concat_leaf(const execution::sequenced_policy& policy,
+                        CountOp                            count_op,
+                        GenerateOp                         generate_op,
+                        ForwardIterator                    first,
+                        ForwardIterator                    last,
+                        ori::global_ptr<T>                 first_d) {
+  std::vector<std::size_t> counts;
+
+  for_each_chunk_aux(
+      policy,
+      [&](std::size_t n, auto it) {
+        counts.resize(n);
+        auto it_ = it;
+        for (std::size_t i = 0; i < n; i++, ++it_) {
+          counts[i] = count_op(*it_);
+        }
+
+        std::size_t i = 0;
+        while (i < n) {
+          std::size_t j = i;
+          std::size_t c = 0;
+          do {
+            c += counts[j++];
+          } while (j < n && c + counts[j] <= policy.checkout_count);
+
+          if (c > 0) {
+            auto cs = make_checkout(first_d, c, dest_checkout_mode_t<T>{});
+            T* out = cs.data();
+            for (; i < j; i++, ++it) {
+              generate_op(*it, out);
+              out += counts[i];
+            }
+            first_d += c;
+          } else {
+            std::advance(it, j - i);
+            i = j;
+          }
+        }
+      },
+      first, last);
+}
+
+template <typename T, typename CountOp, typename GenerateOp, typename ForwardIterator>
+inline global_vector<T> transform_concat_generic(const execution::sequenced_policy& policy,
+                                                 CountOp                            count_op,
+                                                 GenerateOp                         generate_op,
+                                                 ForwardIterator                    first,
+                                                 ForwardIterator                    last) {
+  execution::internal::assert_policy(policy);
+
+  std::size_t total = concat_count(policy, count_op, first, last);
+  if (total == 0) {
+    return global_vector<T>();
+  }
+
+  global_vector<T> ret(total);
+  concat_leaf(policy, count_op, generate_op, first, last, ret.data());
+  return ret;
+}
+
+// The output sizes are counted for each block and exclusively scanned, as in `copy_if_generic()`,
+// so that the output vector is allocated only once and each block writes its outputs directly to
+// its own slice. Every output element is written exactly once.
+template <typename T, typename W, typename CountOp, typename GenerateOp, typename ForwardIterator>
+inline global_vector<T> transform_concat_generic(const execution::parallel_policy<W>& policy,
+                                                 CountOp                              count_op,
+                                                 GenerateOp                           generate_op,
+                                                 ForwardIterator                      first,
+                                                 ForwardIterator                      last) {
+  using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+
+  execution::internal::assert_policy(policy);
+
+  std::size_t n = std::distance(first, last);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(value_type));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    return transform_concat_generic<T>(seq_policy, count_op, generate_op, first, last);
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<std::size_t> counts = ori::malloc<std::size_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(counts, checkout_mode::write),
+      [=](std::size_t i, std::size_t& count) {
+        std::size_t d = std::min(n - i * b, b);
+        auto first_ = std::next(first, i * b);
+        count = concat_count(seq_policy, count_op, first_, std::next(first_, d));
+      });
+
+  std::size_t total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(counts    , checkout_mode::read_write),
+      make_global_iterator(counts + m, checkout_mode::read_write),
+      [&](std::size_t& count) {
+        std::size_t c = count;
+        count = total;
+        total += c;
+      });
+
+  global_vector<T> ret;
+
+  if (total > 0) {
+    ret.resize(total);
+    ori::global_ptr<T> first_d = ret.data();
+
+    for_each(
+        block_policy,
+        count_iterator<std::size_t>(0),
+        count_iterator<std::size_t>(m),
+        make_global_iterator(counts, checkout_mode::read),
+        [=](std::size_t i, std::size_t offset) {
+          std::size_t d = std::min(n - i * b, b);
+          auto first_ = std::next(first, i * b);
+          concat_leaf(seq_policy, count_op, generate_op, first_, std::next(first_, d),
+                      first_d + offset);
+        });
+  }
+
+  ori::free(counts, m);
+
+  return ret;
+}
+
+}
+
+/**
+ * @brief Transform each element into a sequence of elements and concatenate them.
+ *
+ * @tparam T          Element type of the output vector.
+ * @param policy      Execution policy (`ityr::execution`).
+ * @param first       Begin iterator.
+ * @param last        End iterator.
+ * @param count_op    Operator to return the number of output elements for each input element.
+ * @param generate_op Operator to write the output elements for each input element.
+ *
+ * @return A (noncollective) global vector of the concatenated outputs.
+ *
+ * For each input element `x`, `generate_op(x, out)` should write `count_op(x)` elements to the
+ * contiguous memory beginning at `out` (`T*`), and the outputs of all elements are concatenated
+ * in the order of the input range.
+ *
+ * This function is a replacement for `ityr::transform_reduce()` with `ityr::reducer::vec_concat`,
+ * in which partial vectors are concatenated at every join and each element can be copied as many
+ * times as the depth of the reduction tree. Instead, this function counts the output elements first
+ * and scans the counts to determine the output position of each leaf task, so that the output
+ * vector is allocated only once and each output element is written only once. `count_op` is
+ * called twice for each element (for counting and for writing).
+ *
+ * If given iterators are global pointers, they are automatically checked out in the specified
+ * granularity (`ityr::execution::sequenced_policy::checkout_count`) without explicitly passing them
+ * as global iterators. The output elements of consecutive elements are also checked out together
+ * up to this granularity.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {1, 2, 3};
+ * ityr::global_vector<int> ret = ityr::transform_concat<int>(
+ *     ityr::execution::par, v.begin(), v.end(),
+ *     [](int x) { return std::size_t(x); },
+ *     [](int x, int* out) { for (int i = 0; i < x; i++) out[i] = x; });
+ * // ret = {1, 2, 2, 3, 3, 3}
+ * ```
+ *
+ * @see `ityr::reducer::vec_concat`
+ * @see `ityr::copy_if()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename T, typename ExecutionPolicy, typename ForwardIterator,
+          typename CountOp, typename GenerateOp>
+inline global_vector<T> transform_concat(const ExecutionPolicy& policy,
+                                         ForwardIterator        first,
+                                         ForwardIterator        last,
+                                         CountOp                count_op,
+                                         GenerateOp             generate_op) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    return transform_concat<T>(
+        policy,
+        internal::convert_to_global_iterator(first, internal::src_checkout_mode_t<value_type>{}),
+        internal::convert_to_global_iterator(last , internal::src_checkout_mode_t<value_type>{}),
+        count_op,
+        generate_op);
+
+  } else {
+    return internal::transform_concat_generic<T>(policy, count_op, generate_op, first, last);
+  }
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_concat] transform_concat") {
+  ito::init();
+  ori::init();
+
+  ITYR_SUBCASE("variable-length outputs") {
+    root_exec([=] {
+      long n = 20000;
+
+      // element i generates (i % 7) copies of i
+      auto count_op = [](long i) { return std::size_t(i % 7); };
+      auto generate_op = [](long i, long* out) {
+        for (long j = 0; j < i % 7; j++) out[j] = i;
+      };
+
+      global_vector<long> ret = transform_concat<long>(
+          execution::parallel_policy(128),
+          count_iterator<long>(0), count_iterator<long>(n),
+          count_op, generate_op);
+
+      global_vector<long> ans = transform_reduce(
+          execution::parallel_policy(128),
+          count_iterator<long>(0), count_iterator<long>(n),
+          reducer::vec_concat<long>{},
+          [=](long i) {
+            return i % 7 == 0 ? global_vector<long>() : global_vector<long>(i % 7, i);
+          });
+
+      ITYR_CHECK(ret.size() == ans.size());
+      ITYR_CHECK(ret == ans);
+
+      global_vector<long> ret_seq = transform_concat<long>(
+          execution::seq,
+          count_iterator<long>(0), count_iterator<long>(n),
+          count_op, generate_op);
+      ITYR_CHECK(ret_seq == ans);
+    });
+  }
+
+  ITYR_SUBCASE("global input and large outputs") {
+    root_exec([=] {
+      long n = 1000;
+      global_vector<int> v(n);
+      transform(execution::par, count_iterator<long>(0), count_iterator<long>(n), v.begin(),
+                [](long i) { return i % 3 == 0 ? 0 : int(i % 1000); });
+
+      // some elements generate more than `checkout_count` elements
+      global_vector<int> ret = transform_concat<int>(
+          execution::parallel_policy(64, 16),
+          v.begin(), v.end(),
+          [](int x) { return std::size_t(x); },
+          [](int x, int* out) {
+            for (int j = 0; j < x; j++) out[j] = x;
+          });
+
+      auto expected = transform_reduce(execution::par, v.begin(), v.end(), reducer::plus<std::size_t>{},
+                                       [](int x) { return std::size_t(x); });
+      ITYR_CHECK(ret.size() == expected);
+
+      auto sum = transform_reduce(execution::par, ret.begin(), ret.end(), reducer::plus<std::size_t>{},
+                                  [](int x) { return std::size_t(x); });
+      auto sum_sq = transform_reduce(execution::par, v.begin(), v.end(), reducer::plus<std::size_t>{},
+                                     [](int x) { return std::size_t(x) * x; });
+      ITYR_CHECK(sum == sum_sq);
+
+      global_vector<int> empty = transform_concat<int>(
+          execution::par, v.begin(), v.end(),
+          [](int) { return std::size_t(0); },
+          [](int, int*) {});
+      ITYR_CHECK(empty.empty());
+    });
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <vector>
+
 #include "ityr/common/util.hpp"
 #include "ityr/pattern/parallel_invoke.hpp"
 #include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_reduce.hpp"
 
 namespace ityr {
 
@@ -35,6 +38,266 @@ stable_partition_aux(const execution::parallel_policy<W>& policy,
   return rotate(policy, m1, mid, m2);
 }
 
+// Appends the elements `x` in `[first1, last1)` for which `pred(x, ys...)` returns true to `buf`,
+// where `ys...` are the corresponding elements of the other input ranges
+template <typename Predicate, typename T, typename ForwardIterator1, typename... ForwardIterators>
+inline void copy_if_gather(const execution::sequenced_policy& policy,
+                           Predicate                          pred,
+                           std::vector<T>&                    buf,
+                           ForwardIterator1                   first1,
+                           ForwardIterator1                   last1,
+                           ForwardIterators...                firsts) {
+  for_each_chunk_aux(
+      policy,
+      [&](std::size_t n, auto it1, auto... its) {
+        for (std::size_t i = 0; i < n; (++i, ++it1, (..., ++its))) {
+          if (pred(*it1, *its...)) {
+            buf.push_back(*it1);
+          }
+        }
+      },
+      first1, last1, firsts...);
+}
+
+// Each chunk of the input is filtered into a local buffer, which is then written to the output
+// range at once. As the input chunk is checked in before the output is written, the output range
+// can precede the input range in the same region (i.e., `first_d <= first1`).
+template <typename Predicate, typename ForwardIterator1, typename ForwardIteratorD,
+          typename... ForwardIterators>
+inline ForwardIteratorD copy_if_leaf(const execution::sequenced_policy& policy,
+                                     Predicate                          pred,
+                                     ForwardIterator1                   first1,
+                                     ForwardIterator1                   last1,
+                                     ForwardIteratorD                   first_d,
+                                     ForwardIterators...                firsts) {
+  using value_type1 = typename std::iterator_traits<ForwardIterator1>::value_type;
+
+  std::size_t n = std::distance(first1, last1);
+  std::size_t c = policy.checkout_count;
+
+  std::vector<value_type1> buf;
+
+  for (std::size_t d = 0; d < n; d += c) {
+    auto n_ = std::min(n - d, c);
+
+    buf.clear();
+    copy_if_gather(policy, pred, buf, first1, std::next(first1, n_), firsts...);
+
+    for_each_aux(
+        policy,
+        [](auto&& src, auto&& dst) { dst = std::move(src); },
+        buf.begin(), buf.end(), first_d);
+
+    first_d = std::next(first_d, buf.size());
+    ((first1 = std::next(first1, n_)), ..., (firsts = std::next(firsts, n_)));
+  }
+
+  return first_d;
+}
+
+template <typename Predicate, typename ForwardIterator1, typename ForwardIteratorD,
+          typename... ForwardIterators>
+inline ForwardIteratorD copy_if_generic(const execution::sequenced_policy& policy,
+                                        Predicate                          pred,
+                                        ForwardIterator1                   first1,
+                                        ForwardIterator1                   last1,
+                                        ForwardIteratorD                   first_d,
+                                        ForwardIterators...                firsts) {
+  execution::internal::assert_policy(policy);
+  return copy_if_leaf(policy, pred, first1, last1, first_d, firsts...);
+}
+
+// Stream compaction in three passes over blocks: (1) the number of selected elements in each
+// block is counted in parallel, (2) the counts are exclusively scanned (serially, as there are
+// only n / B of them), and (3) each block is filtered again and written to its output position
+// in parallel. The input range is read twice, and the output range is written only once.
+template <typename W, typename Predicate, typename ForwardIterator1, typename ForwardIteratorD,
+          typename... ForwardIterators>
+inline ForwardIteratorD copy_if_generic(const execution::parallel_policy<W>& policy,
+                                        Predicate                            pred,
+                                        ForwardIterator1                     first1,
+                                        ForwardIterator1                     last1,
+                                        ForwardIteratorD                     first_d,
+                                        ForwardIterators...                  firsts) {
+  using value_type_d = typename std::iterator_traits<ForwardIteratorD>::value_type;
+
+  execution::internal::assert_policy(policy);
+
+  std::size_t n = std::distance(first1, last1);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(value_type_d));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    return copy_if_leaf(seq_policy, pred, first1, last1, first_d, firsts...);
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<std::size_t> counts = ori::malloc<std::size_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(counts, checkout_mode::write),
+      [=](std::size_t i, std::size_t& count) {
+        std::size_t d = std::min(n - i * b, b);
+        auto first1_ = std::next(first1, i * b);
+        std::size_t c = 0;
+        for_each_aux(
+            seq_policy,
+            [&](auto&& x, auto&&... ys) {
+              if (pred(x, ys...)) c++;
+            },
+            first1_, std::next(first1_, d), std::next(firsts, i * b)...);
+        count = c;
+      });
+
+  std::size_t total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(counts    , checkout_mode::read_write),
+      make_global_iterator(counts + m, checkout_mode::read_write),
+      [&](std::size_t& count) {
+        std::size_t c = count;
+        count = total;
+        total += c;
+      });
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(counts, checkout_mode::read),
+      [=](std::size_t i, std::size_t offset) {
+        std::size_t d = std::min(n - i * b, b);
+        auto first1_ = std::next(first1, i * b);
+        copy_if_leaf(seq_policy, pred, first1_, std::next(first1_, d), std::next(first_d, offset),
+                     std::next(firsts, i * b)...);
+      });
+
+  ori::free(counts, m);
+
+  return std::next(first_d, total);
+}
+
+template <typename T>
+struct copy_if_stage {
+  ori::global_ptr<T> buf;
+  std::size_t        count;
+  std::size_t        offset;
+};
+
+// Same as `copy_if_generic()`, but the output range can precede the input range in the same region
+// (i.e., `first_d <= first1`), so that elements can be compacted in place.
+template <typename Predicate, typename ForwardIterator1, typename ForwardIteratorD,
+          typename... ForwardIterators>
+inline ForwardIteratorD copy_if_in_place(const execution::sequenced_policy& policy,
+                                         Predicate                          pred,
+                                         ForwardIterator1                   first1,
+                                         ForwardIterator1                   last1,
+                                         ForwardIteratorD                   first_d,
+                                         ForwardIterators...                firsts) {
+  execution::internal::assert_policy(policy);
+  return copy_if_leaf(policy, pred, first1, last1, first_d, firsts...);
+}
+
+// Blocks cannot be written to their output positions while other blocks are still being read,
+// so the selected elements of each block are first staged in a buffer allocated by the task that
+// filtered the block, and they are moved to the output range after all blocks have been read.
+template <typename W, typename Predicate, typename ForwardIterator1, typename ForwardIteratorD,
+          typename... ForwardIterators>
+inline ForwardIteratorD copy_if_in_place(const execution::parallel_policy<W>& policy,
+                                         Predicate                            pred,
+                                         ForwardIterator1                     first1,
+                                         ForwardIterator1                     last1,
+                                         ForwardIteratorD                     first_d,
+                                         ForwardIterators...                  firsts) {
+  using value_type1 = typename std::iterator_traits<ForwardIterator1>::value_type;
+  using stage_t     = copy_if_stage<value_type1>;
+
+  execution::internal::assert_policy(policy);
+
+  std::size_t n = std::distance(first1, last1);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(value_type1));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    return copy_if_leaf(seq_policy, pred, first1, last1, first_d, firsts...);
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<stage_t> stages = ori::malloc<stage_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(stages, checkout_mode::write),
+      [=](std::size_t i, stage_t& stage) {
+        std::size_t d = std::min(n - i * b, b);
+        auto first1_ = std::next(first1, i * b);
+
+        std::vector<value_type1> buf;
+        copy_if_gather(seq_policy, pred, buf, first1_, std::next(first1_, d),
+                       std::next(firsts, i * b)...);
+
+        std::size_t c = buf.size();
+        ori::global_ptr<value_type1> p = c > 0 ? ori::malloc<value_type1>(c) : nullptr;
+        if (c > 0) {
+          for_each(
+              seq_policy,
+              std::make_move_iterator(buf.begin()),
+              std::make_move_iterator(buf.end()),
+              make_construct_iterator(p),
+              [](auto&& src, value_type1* dst) { new (dst) value_type1(std::move(src)); });
+        }
+        stage = stage_t{p, c, 0};
+      });
+
+  std::size_t total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(stages    , checkout_mode::read_write),
+      make_global_iterator(stages + m, checkout_mode::read_write),
+      [&](stage_t& stage) {
+        stage.offset = total;
+        total += stage.count;
+      });
+
+  for_each(
+      block_policy,
+      make_global_iterator(stages    , checkout_mode::read),
+      make_global_iterator(stages + m, checkout_mode::read),
+      [=](const stage_t& stage) {
+        if (stage.count > 0) {
+          for_each(
+              seq_policy,
+              make_destruct_iterator(stage.buf),
+              make_destruct_iterator(stage.buf + stage.count),
+              std::next(first_d, stage.offset),
+              [](value_type1* src, auto&& dst) {
+                dst = std::move(*src);
+                std::destroy_at(src);
+              });
+          ori::free(stage.buf, stage.count);
+        }
+      });
+
+  ori::free(stages, m);
+
+  return std::next(first_d, total);
+}
+
 }
 
 /**
@@ -252,4 +515,531 @@ inline BidirectionalIterator partition(const ExecutionPolicy& policy,
   return stable_partition(policy, first, last, pred);
 }
 
+/**
+ * @brief Copy the elements that satisfy a predicate to another range.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param pred    Predicate operator to select elements.
+ *
+ * @return The end iterator of the output range.
+ *
+ * This function copies the elements `x` in the input range `[first1, last1)` for which `pred(x)`
+ * returns true to the output range beginning at `first_d`, preserving their relative order.
+ *
+ * With a parallel policy, the input range is divided into blocks of at least `cutoff_count`
+ * elements (and at least one cache block of the output range). The selected elements of each block
+ * are first counted in parallel, and then each block is filtered again and written to its output
+ * position, which is given by the exclusive scan of the counts. Thus, `pred` is applied twice to
+ * each element. In each block, the selected elements are gathered in a local buffer for every
+ * checkout chunk and written to the output range at once.
+ *
+ * If given iterators are global pointers, they are automatically checked out in the specified
+ * granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
+ * or `ityr::execution::parallel_policy::checkout_count` if parallel) without explicitly passing them
+ * as global iterators.
+ * Input global pointers (`first1` and `last1`) are automatically checked out with the read-only mode
+ * if their value type is *trivially copyable*; otherwise, they are checked out with the read-write
+ * mode, even if they are actually not modified.
+ * Similarly, output global iterator (`first_d`) are checked out with the write-only mode if their
+ * value type is *trivially copyable*; otherwise, they are checked out with the read-write mode.
+ *
+ * The input and output regions should not be overlapped.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2(v1.size());
+ * auto it = ityr::copy_if(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                         [](int x) { return x % 2 == 0; });
+ * // v2 = {2, 4, 0, 0, 0}
+ * //            ^
+ * //            it
+ * ```
+ *
+ * @see [std::copy_if -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/copy)
+ * @see `ityr::remove_copy_if()`
+ * @see `ityr::stable_partition()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Predicate>
+inline ForwardIteratorD copy_if(const ExecutionPolicy& policy,
+                                ForwardIterator1       first1,
+                                ForwardIterator1       last1,
+                                ForwardIteratorD       first_d,
+                                Predicate              pred) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator1> ||
+                ori::is_global_ptr_v<ForwardIteratorD>) {
+    using value_type1  = typename std::iterator_traits<ForwardIterator1>::value_type;
+    using value_type_d = typename std::iterator_traits<ForwardIteratorD>::value_type;
+    return copy_if(
+        policy,
+        internal::convert_to_global_iterator(first1 , internal::src_checkout_mode_t<value_type1>{}),
+        internal::convert_to_global_iterator(last1  , internal::src_checkout_mode_t<value_type1>{}),
+        internal::convert_to_global_iterator(first_d, internal::dest_checkout_mode_t<value_type_d>{}),
+        pred);
+
+  } else {
+    return internal::copy_if_generic(policy, pred, first1, last1, first_d);
+  }
+}
+
+/**
+ * @brief Copy the elements that do not satisfy a predicate to another range.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param pred    Predicate operator to determine elements to be removed.
+ *
+ * @return The end iterator of the output range.
+ *
+ * Equivalent to `ityr::copy_if()` with the negated predicate.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2(v1.size());
+ * auto it = ityr::remove_copy_if(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                                [](int x) { return x % 2 == 0; });
+ * // v2 = {1, 3, 5, 0, 0}
+ * //               ^
+ * //               it
+ * ```
+ *
+ * @see [std::remove_copy_if -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/remove_copy)
+ * @see `ityr::copy_if()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Predicate>
+inline ForwardIteratorD remove_copy_if(const ExecutionPolicy& policy,
+                                       ForwardIterator1       first1,
+                                       ForwardIterator1       last1,
+                                       ForwardIteratorD       first_d,
+                                       Predicate              pred) {
+  return copy_if(policy, first1, last1, first_d,
+                 [=](const auto& x) { return !pred(x); });
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_filter] copy_if") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p1 = ori::malloc_coll<long>(n);
+  ori::global_ptr<long> p2 = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    transform(
+        execution::parallel_policy(100),
+        count_iterator<long>(0), count_iterator<long>(n), p1,
+        [=](long i) { return i; });
+  });
+
+  ITYR_SUBCASE("parallel") {
+    ito::root_exec([=] {
+      auto e = copy_if(
+          execution::parallel_policy(100),
+          p1, p1 + n, p2,
+          [](long x) { return x % 3 == 0; });
+
+      ITYR_CHECK(e == p2 + (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i * 3); });
+    });
+  }
+
+  ITYR_SUBCASE("serial") {
+    ito::root_exec([=] {
+      auto e = copy_if(
+          execution::sequenced_policy(100),
+          p1, p1 + n, p2,
+          [](long x) { return x % 3 == 0; });
+
+      ITYR_CHECK(e == p2 + (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i * 3); });
+    });
+  }
+
+  ITYR_SUBCASE("remove_copy_if") {
+    ito::root_exec([=] {
+      auto e = remove_copy_if(
+          execution::parallel_policy(100),
+          p1, p1 + n, p2,
+          [](long x) { return x % 3 == 0; });
+
+      ITYR_CHECK(e == p2 + n - (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == (i / 2) * 3 + (i % 2) + 1); });
+    });
+  }
+
+  ITYR_SUBCASE("non-global input") {
+    ito::root_exec([=] {
+      auto e = copy_if(
+          execution::parallel_policy(100),
+          count_iterator<long>(0), count_iterator<long>(n), p2,
+          [](long x) { return x % 1000 == 7; });
+
+      ITYR_CHECK(e == p2 + n / 1000);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i * 1000 + 7); });
+    });
+  }
+
+  ITYR_SUBCASE("corner cases") {
+    ito::root_exec([=] {
+      auto e1 = copy_if(
+          execution::parallel_policy(100),
+          p1, p1 + n, p2,
+          [](long) { return false; });
+
+      ITYR_CHECK(e1 == p2);
+
+      auto e2 = copy_if(
+          execution::parallel_policy(100),
+          p1, p1 + n, p2,
+          [](long) { return true; });
+
+      ITYR_CHECK(e2 == p2 + n);
+      ITYR_CHECK(equal(execution::parallel_policy(100), p1, p1 + n, p2));
+    });
+  }
+
+  ori::free_coll(p1);
+  ori::free_coll(p2);
+
+  ori::fini();
+  ito::fini();
+}
+
+/**
+ * @brief Copy a range to another, except for consecutive equivalent elements.
+ *
+ * @param policy      Execution policy (`ityr::execution`).
+ * @param first1      Input begin iterator.
+ * @param last1       Input end iterator.
+ * @param first_d     Output begin iterator.
+ * @param binary_pred Binary predicate operator to determine the equivalence of two elements.
+ *
+ * @return The end iterator of the output range.
+ *
+ * This function copies the elements in the input range `[first1, last1)` to the output range
+ * beginning at `first_d`, except for each element `y` whose preceding element `x` satisfies
+ * `binary_pred(x, y) == true`. That is, only the first element of each group of consecutive
+ * equivalent elements is copied.
+ *
+ * This is implemented as `ityr::copy_if()` over pairs of adjacent elements. See `ityr::copy_if()`
+ * for the parallel execution and automatic checkout of global pointers.
+ *
+ * The input and output regions should not be overlapped.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 1, 2, 2, 2, 3, 1};
+ * ityr::global_vector<int> v2(v1.size());
+ * auto it = ityr::unique_copy(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                             [](int x, int y) { return x == y; });
+ * // v2 = {1, 2, 3, 1, 0, 0, 0}
+ * //                   ^
+ * //                   it
+ * ```
+ *
+ * @see [std::unique_copy -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/unique_copy)
+ * @see `ityr::unique()`
+ * @see `ityr::copy_if()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename BinaryPredicate>
+inline ForwardIteratorD unique_copy(const ExecutionPolicy& policy,
+                                    ForwardIterator1       first1,
+                                    ForwardIterator1       last1,
+                                    ForwardIteratorD       first_d,
+                                    BinaryPredicate        binary_pred) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator1> ||
+                ori::is_global_ptr_v<ForwardIteratorD>) {
+    using value_type1  = typename std::iterator_traits<ForwardIterator1>::value_type;
+    using value_type_d = typename std::iterator_traits<ForwardIteratorD>::value_type;
+    return unique_copy(
+        policy,
+        internal::convert_to_global_iterator(first1 , internal::src_checkout_mode_t<value_type1>{}),
+        internal::convert_to_global_iterator(last1  , internal::src_checkout_mode_t<value_type1>{}),
+        internal::convert_to_global_iterator(first_d, internal::dest_checkout_mode_t<value_type_d>{}),
+        binary_pred);
+
+  } else {
+    if (first1 == last1) {
+      return first_d;
+    }
+
+    // The first element is always copied
+    auto seq_policy = execution::internal::to_sequenced_policy(policy);
+    first_d = internal::copy_if_generic(seq_policy, [](const auto&) { return true; },
+                                        first1, std::next(first1), first_d);
+
+    return internal::copy_if_generic(
+        policy,
+        [=](const auto& cur, const auto& prev) { return !binary_pred(prev, cur); },
+        std::next(first1), last1, first_d, first1);
+  }
+}
+
+/**
+ * @brief Copy a range to another, except for consecutive equal elements.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ *
+ * @return The end iterator of the output range.
+ *
+ * Equivalent to `ityr::unique_copy(policy, first1, last1, first_d, std::equal_to<>{})`.
+ *
+ * @see [std::unique_copy -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/unique_copy)
+ * @see `ityr::unique()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD>
+inline ForwardIteratorD unique_copy(const ExecutionPolicy& policy,
+                                    ForwardIterator1       first1,
+                                    ForwardIterator1       last1,
+                                    ForwardIteratorD       first_d) {
+  return unique_copy(policy, first1, last1, first_d, std::equal_to<>{});
+}
+
+/**
+ * @brief Remove consecutive equivalent elements in a range.
+ *
+ * @param policy      Execution policy (`ityr::execution`).
+ * @param first       Begin iterator.
+ * @param last        End iterator.
+ * @param binary_pred Binary predicate operator to determine the equivalence of two elements.
+ *
+ * @return The end iterator of the resulting range.
+ *
+ * This function removes each element `y` in the range `[first, last)` whose preceding element `x`
+ * satisfies `binary_pred(x, y) == true`, and the remaining elements are compacted to the beginning
+ * of the range in their original order. The elements after the returned iterator are left in a
+ * valid but unspecified state.
+ *
+ * With a parallel policy, the range is divided into blocks as in `ityr::unique_copy()`. Because a
+ * block cannot be written while the other blocks are being read, the remaining elements of each
+ * block are first copied to a temporary buffer allocated by the task that processed the block, and
+ * they are moved back to their final positions after all blocks have been read. The temporary
+ * buffers are allocated from the noncollective heap of each process.
+ *
+ * If global pointers are provided as iterators, they are automatically checked out in the specified
+ * granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
+ * or `ityr::execution::parallel_policy::checkout_count` if parallel) without explicitly passing them
+ * as global iterators. They are read with the read-only mode and written with the write-only mode
+ * if their value type is *trivially copyable*; otherwise, the read-write mode is used.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {1, 1, 2, 2, 2, 3, 1};
+ * auto it = ityr::unique(ityr::execution::par, v.begin(), v.end(),
+ *                        [](int x, int y) { return x == y; });
+ * // v = {1, 2, 3, 1, ?, ?, ?}
+ * //                  ^
+ * //                  it
+ * ```
+ *
+ * @see [std::unique -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/unique)
+ * @see `ityr::unique_copy()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename BinaryPredicate>
+inline ForwardIterator unique(const ExecutionPolicy& policy,
+                              ForwardIterator        first,
+                              ForwardIterator        last,
+                              BinaryPredicate        binary_pred) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    auto first_r = internal::convert_to_global_iterator(first, internal::src_checkout_mode_t<value_type>{});
+    auto last_r  = internal::convert_to_global_iterator(last , internal::src_checkout_mode_t<value_type>{});
+    auto first_w = internal::convert_to_global_iterator(first, internal::dest_checkout_mode_t<value_type>{});
+
+    if (first == last) {
+      return last;
+    }
+
+    auto last_w = internal::copy_if_in_place(
+        policy,
+        [=](const auto& cur, const auto& prev) { return !binary_pred(prev, cur); },
+        std::next(first_r), last_r, std::next(first_w), first_r);
+
+    return first + std::distance(first_w, last_w);
+
+  } else {
+    if (first == last) {
+      return last;
+    }
+
+    return internal::copy_if_in_place(
+        policy,
+        [=](const auto& cur, const auto& prev) { return !binary_pred(prev, cur); },
+        std::next(first), last, std::next(first), first);
+  }
+}
+
+/**
+ * @brief Remove consecutive equal elements in a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ *
+ * @return The end iterator of the resulting range.
+ *
+ * Equivalent to `ityr::unique(policy, first, last, std::equal_to<>{})`.
+ *
+ * @see [std::unique -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/unique)
+ * @see `ityr::unique_copy()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator>
+inline ForwardIterator unique(const ExecutionPolicy& policy,
+                              ForwardIterator        first,
+                              ForwardIterator        last) {
+  return unique(policy, first, last, std::equal_to<>{});
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_filter] unique") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p1 = ori::malloc_coll<long>(n);
+  ori::global_ptr<long> p2 = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    // {0, 0, 0, 1, 1, 1, 2, ...}
+    transform(
+        execution::parallel_policy(100),
+        count_iterator<long>(0), count_iterator<long>(n), p1,
+        [=](long i) { return i / 3; });
+  });
+
+  ITYR_SUBCASE("unique_copy") {
+    ito::root_exec([=] {
+      auto e = unique_copy(execution::parallel_policy(100), p1, p1 + n, p2);
+
+      ITYR_CHECK(e == p2 + (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i); });
+    });
+  }
+
+  ITYR_SUBCASE("unique_copy with a predicate") {
+    ito::root_exec([=] {
+      // Groups of values with the same quotient by 10
+      auto e = unique_copy(execution::sequenced_policy(100), p1, p1 + n, p2,
+                           [](long x, long y) { return x / 10 == y / 10; });
+
+      ITYR_CHECK(e == p2 + ((n + 2) / 3 + 9) / 10);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p2, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i * 10); });
+    });
+  }
+
+  ITYR_SUBCASE("unique") {
+    ito::root_exec([=] {
+      auto e = unique(execution::parallel_policy(100), p1, p1 + n);
+
+      ITYR_CHECK(e == p1 + (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p1, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i); });
+
+      // No more consecutive equal elements
+      auto e2 = unique(execution::parallel_policy(100), p1, e);
+      ITYR_CHECK(e2 == e);
+    });
+  }
+
+  ITYR_SUBCASE("unique (serial)") {
+    ito::root_exec([=] {
+      auto e = unique(execution::sequenced_policy(100), p1, p1 + n);
+
+      ITYR_CHECK(e == p1 + (n + 2) / 3);
+
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p1, checkout_mode::read),
+          make_global_iterator(e , checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i); });
+    });
+  }
+
+  ITYR_SUBCASE("corner cases") {
+    ito::root_exec([=] {
+      auto e1 = unique(execution::parallel_policy(100), p1, p1);
+      ITYR_CHECK(e1 == p1);
+
+      auto e2 = unique_copy(execution::parallel_policy(100), p1, p1, p2);
+      ITYR_CHECK(e2 == p2);
+
+      auto e3 = unique(execution::parallel_policy(100), p1, p1 + n,
+                       [](long, long) { return true; });
+      ITYR_CHECK(e3 == p1 + 1);
+      ITYR_CHECK(p1[0].get() == 0);
+    });
+  }
+
+  ori::free_coll(p1);
+  ori::free_coll(p2);
+
+  ori::fini();
+  ito::fini();
+}
+
 }
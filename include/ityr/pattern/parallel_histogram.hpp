@@ -0,0 +1,214 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "ityr/common/util.hpp"
+#include "ityr/ori/ori.hpp"
+#include "ityr/pattern/count_iterator.hpp"
+#include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_reduce.hpp"
+#include "ityr/pattern/reducer_extra.hpp"
+#include "ityr/container/global_vector.hpp"
+
+namespace ityr {
+
+namespace internal {
+
+// Adds the counts of the (unsorted) bin indices in `keys` to the bins at `d_first`. Each run of
+// adjacent nonempty bins is added by a single atomic operation (per memory segment), and all of
+// them are completed at once.
+template <typename Counter>
+inline void histogram_flush_sparse(std::vector<std::size_t>& keys, ori::global_ptr<Counter> d_first) {
+  if (keys.empty()) return;
+
+  std::sort(keys.begin(), keys.end());
+
+  // reserved so that the buffers of in-flight atomic operations are not reallocated
+  std::vector<Counter> counts;
+  counts.reserve(keys.size());
+
+  std::size_t run_key = keys[0];
+  std::size_t run_b   = 0;
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    if (i > 0 && keys[i] == keys[i - 1]) {
+      counts.back()++;
+      continue;
+    }
+    if (i > 0 && keys[i] != keys[i - 1] + 1) {
+      ori::atomic_add_nb(counts.data() + run_b, d_first + run_key, counts.size() - run_b);
+      run_key = keys[i];
+      run_b   = counts.size();
+    }
+    counts.push_back(1);
+  }
+  ori::atomic_add_nb(counts.data() + run_b, d_first + run_key, counts.size() - run_b);
+
+  ori::atomic_complete();
+}
+
+}
+
+/**
+ * @brief Count the elements of a range into the bins of a global array by atomic adds.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first   Begin iterator.
+ * @param last    End iterator.
+ * @param d_first Begin iterator of the bins (a global pointer).
+ * @param d_last  End iterator of the bins (a global pointer).
+ * @param lowest  Lower bound of the histogram range.
+ * @param highest Upper bound of the histogram range.
+ *
+ * The range `[lowest, highest]` is divided into `d_last - d_first` bins of equal width, and the
+ * number of elements in each bin is added to the corresponding element of the output range.
+ * The output range is not cleared beforehand. Elements out of `[lowest, highest]` are ignored.
+ *
+ * Unlike `ityr::reducer::histogram` and `ityr::reducer::histogram_local`, the bins are not
+ * duplicated for each task; each chunk of the input is counted in a local buffer, which is then
+ * atomically added to the owners of the bins (bypassing the cache). Thus, this is suitable for
+ * histograms with many bins distributed over processes (e.g., a collective `ityr::global_vector`).
+ * The output range must not be accessed by other tasks until this function returns.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<double> v = {0.1, 0.2, 0.6, 0.9, 1.5};
+ * ityr::global_vector<std::size_t> bins(ityr::global_vector_options(true), 2, 0);
+ * ityr::histogram(ityr::execution::par, v.begin(), v.end(), bins.begin(), bins.end(), 0.0, 1.0);
+ * // bins = {2, 2}
+ * ```
+ *
+ * @see `ityr::reducer::histogram`, `ityr::reducer::histogram_local`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename Counter>
+inline void histogram(const ExecutionPolicy&                                          policy,
+                      ForwardIterator                                                 first,
+                      ForwardIterator                                                 last,
+                      ori::global_ptr<Counter>                                        d_first,
+                      ori::global_ptr<Counter>                                        d_last,
+                      const typename std::iterator_traits<ForwardIterator>::value_type& lowest,
+                      const typename std::iterator_traits<ForwardIterator>::value_type& highest) {
+  using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+  static_assert(std::is_arithmetic_v<value_type>);
+
+  std::size_t n_bins = std::distance(d_first, d_last);
+  if (n_bins == 0) return;
+
+  // Dirty cache blocks of the bins must be written back before they are updated at the owners,
+  // and stale cache blocks must be invalidated afterwards.
+  ori::release();
+
+  auto count_chunk = [=](auto first_, auto last_) {
+    std::size_t c = std::distance(first_, last_);
+    if (n_bins <= c) {
+      // dense local bins are cheaper than sorting if there are fewer bins than elements
+      std::vector<Counter> counts(n_bins, 0);
+      for (; first_ != last_; ++first_) {
+        const value_type& x = *first_;
+        if (lowest <= x && x <= highest) {
+          counts[internal::histogram_bin(x, lowest, highest, n_bins)]++;
+        }
+      }
+      ori::atomic_add_nb(counts.data(), d_first, n_bins);
+      ori::atomic_complete();
+
+    } else {
+      std::vector<std::size_t> keys;
+      keys.reserve(c);
+      for (; first_ != last_; ++first_) {
+        const value_type& x = *first_;
+        if (lowest <= x && x <= highest) {
+          keys.push_back(internal::histogram_bin(x, lowest, highest, n_bins));
+        }
+      }
+      internal::histogram_flush_sparse(keys, d_first);
+    }
+  };
+
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    for_each_chunk(
+        policy,
+        make_global_iterator(first, checkout_mode::read),
+        make_global_iterator(last , checkout_mode::read),
+        count_chunk);
+  } else {
+    for_each_chunk(policy, first, last, count_chunk);
+  }
+
+  ori::acquire();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_histogram] histogram") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+
+  ITYR_SUBCASE("few bins") {
+    std::size_t n_bins = 10;
+    global_vector<std::size_t> bins(global_vector_options(true, 1024), n_bins, 0);
+
+    root_exec([=, bins = global_span<std::size_t>(bins)] {
+      global_vector<double> v(n);
+      transform(
+          execution::par,
+          count_iterator<long>(0), count_iterator<long>(n), v.begin(),
+          [=](long i) { return static_cast<double>(i % n_bins) + 0.5; });
+
+      histogram(execution::parallel_policy(128), v.begin(), v.end(),
+                bins.begin(), bins.end(), 0.0, double(n_bins));
+
+      for_each(
+          execution::par,
+          make_global_iterator(bins.begin(), checkout_mode::read),
+          make_global_iterator(bins.end()  , checkout_mode::read),
+          [=](std::size_t count) { ITYR_CHECK(count == std::size_t(n) / n_bins); });
+
+      // counts are added to the existing ones
+      histogram(execution::parallel_policy(128), v.begin(), v.end(),
+                bins.begin(), bins.end(), 0.0, double(n_bins));
+
+      auto count_sum = reduce(execution::par, bins.begin(), bins.end());
+      ITYR_CHECK(count_sum == std::size_t(n) * 2);
+    });
+  }
+
+  ITYR_SUBCASE("many distributed bins") {
+    std::size_t n_bins = 50000;
+    global_vector<std::size_t> bins(global_vector_options(true, 1024), n_bins, 0);
+
+    root_exec([=, bins = global_span<std::size_t>(bins)] {
+      global_vector<long> v(n);
+      transform(
+          execution::par,
+          count_iterator<long>(0), count_iterator<long>(n), v.begin(),
+          [=](long i) { return (i * 7919) % (n + 10000) - 5000; }); // some are out of range
+
+      long lowest  = 0;
+      long highest = n_bins * 2 - 1;
+      histogram(execution::parallel_policy(128), v.begin(), v.end(),
+                bins.begin(), bins.end(), lowest, highest);
+
+      // compare with a serially computed histogram
+      std::vector<std::size_t> ans(n_bins, 0);
+      for_each(
+          execution::sequenced_policy(1024),
+          make_global_iterator(v.begin(), checkout_mode::read),
+          make_global_iterator(v.end()  , checkout_mode::read),
+          [&](long x) {
+            if (lowest <= x && x <= highest) ans[x / 2]++;
+          });
+      for_each(
+          execution::sequenced_policy(1024),
+          make_global_iterator(bins.begin(), checkout_mode::read),
+          make_global_iterator(bins.end()  , checkout_mode::read),
+          count_iterator<std::size_t>(0),
+          [&](std::size_t count, std::size_t b) { ITYR_CHECK(count == ans[b]); });
+    });
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
+}
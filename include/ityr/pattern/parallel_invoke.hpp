@@ -70,7 +70,8 @@ constexpr inline W get_total_work(const Fn&, const std::tuple<Args...>&, workhin
 template <typename ReleaseHandler>
 struct parallel_invoke_state {
 public:
-  parallel_invoke_state(ReleaseHandler rh) : rh_(rh) {}
+  parallel_invoke_state(ReleaseHandler rh, ito::fork_policy fp = ito::fork_policy::work_first)
+    : rh_(rh), fp_(fp) {}
 
   bool all_serialized() const { return all_serialized_; }
 
@@ -171,7 +172,7 @@ private:
               [&](ori::release_handler rh) { ori::acquire(rh); ori::acquire(rh_); });
 
     ito::thread<retval_t> th(
-        ito::with_callback, [rh = rh_] { ori::acquire(rh); }, [] { ori::release(); }, iwh,
+        fp_, ito::with_callback, [rh = rh_] { ori::acquire(rh); }, [] { ori::release(); }, iwh,
         [fn         = std::forward<Fn>(fn),
          args_tuple = std::forward<ArgsTuple>(args_tuple)]() mutable {
           return std::apply(std::forward<decltype(fn)>(fn),
@@ -201,10 +202,32 @@ private:
     }
   }
 
-  ReleaseHandler rh_;
-  bool           all_serialized_ = true;
+  ReleaseHandler   rh_;
+  ito::fork_policy fp_;
+  bool             all_serialized_ = true;
 };
 
+template <typename... Args>
+inline auto parallel_invoke_with_fork_policy(ito::fork_policy fp, Args&&... args) {
+  auto rh = ori::release_lazy();
+
+  ito::task_group_data tgdata;
+  ito::task_group_begin(&tgdata);
+
+  parallel_invoke_state s(rh, fp);
+  auto&& ret = s.parallel_invoke_aux(std::forward<Args>(args)...);
+
+  // No lazy release here because the suspended thread (cross-worker tasks in ADWS) is
+  // always resumed by another process.
+  ito::task_group_end([] { ori::release(); }, [] { ori::acquire(); });
+
+  // TODO: avoid duplicated acquire calls
+  if (!s.all_serialized()) {
+    ori::acquire();
+  }
+  return std::move(ret);
+}
+
 }
 
 /**
@@ -236,23 +259,38 @@ private:
  */
 template <typename... Args>
 inline auto parallel_invoke(Args&&... args) {
-  auto rh = ori::release_lazy();
-
-  ito::task_group_data tgdata;
-  ito::task_group_begin(&tgdata);
-
-  internal::parallel_invoke_state s(rh);
-  auto&& ret = s.parallel_invoke_aux(std::forward<Args>(args)...);
-
-  // No lazy release here because the suspended thread (cross-worker tasks in ADWS) is
-  // always resumed by another process.
-  ito::task_group_end([] { ori::release(); }, [] { ori::acquire(); });
+  return internal::parallel_invoke_with_fork_policy(ito::fork_policy::work_first,
+                                                    std::forward<Args>(args)...);
+}
 
-  // TODO: avoid duplicated acquire calls
-  if (!s.all_serialized()) {
-    ori::acquire();
-  }
-  return std::move(ret);
+/**
+ * @brief Fork parallel tasks with the given fork policy and join them.
+ *
+ * @param policy  Fork policy (`ito::fork_policy::work_first` or `ito::fork_policy::help_first`).
+ * @param args... Sequence of function objects and their arguments (see `ityr::parallel_invoke()`).
+ *
+ * @return A tuple collecting the results of each function invocation.
+ *
+ * With the help-first policy, the child tasks are pushed to the task queue as closures before
+ * the last task is executed, which avoids copying the call stack when they are stolen.
+ * This is beneficial for wide and flat task parallelism.
+ *
+ * Example:
+ * ```
+ * ityr::parallel_invoke(
+ *   ityr::ito::fork_policy::help_first,
+ *   []() { return 1; },
+ *   []() { return 2; },
+ *   []() { return 3; }
+ * );
+ * // returns std::tuple(1, 2, 3)
+ * ```
+ *
+ * @see `ityr::parallel_invoke()`
+ */
+template <typename... Args>
+inline auto parallel_invoke(ito::fork_policy policy, Args&&... args) {
+  return internal::parallel_invoke_with_fork_policy(policy, std::forward<Args>(args)...);
 }
 
 ITYR_TEST_CASE("[ityr::pattern::parallel_invoke] parallel invoke") {
@@ -332,6 +370,20 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_invoke] parallel invoke") {
     });
   }
 
+  ITYR_SUBCASE("help-first") {
+    ito::root_exec([=] {
+      auto [x, y, z] = parallel_invoke(
+        ito::fork_policy::help_first,
+        []() { return 1; },
+        [](int i) { return i * 2; }, std::make_tuple(2),
+        []() { return 4.8; }
+      );
+      ITYR_CHECK(x == 1);
+      ITYR_CHECK(y == 4);
+      ITYR_CHECK(z == 4.8);
+    });
+  }
+
   ITYR_SUBCASE("corner cases") {
     ito::root_exec([=] {
       ITYR_CHECK(parallel_invoke() == std::make_tuple());
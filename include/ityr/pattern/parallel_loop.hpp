@@ -13,14 +13,38 @@ namespace ityr {
 
 namespace internal {
 
+template <typename Op, typename ForwardIterator, typename... ForwardIterators>
+inline void loop_leaf(const execution::sequenced_policy& policy,
+                      const Op&                          op,
+                      ForwardIterator                    first,
+                      ForwardIterator                    last,
+                      ForwardIterators...                firsts) {
+  if constexpr (is_chunk_op_v<Op>) {
+    for_each_chunk_aux(
+        policy,
+        [&](auto&&... args) {
+          op.op(std::forward<decltype(args)>(args)...);
+        },
+        first, last, firsts...);
+  } else {
+    for_each_aux(
+        policy,
+        [&](auto&&... refs) {
+          op(std::forward<decltype(refs)>(refs)...);
+        },
+        first, last, firsts...);
+  }
+}
+
+// Returns the execution time of leaf tasks if work hint learning is enabled
 template <typename W, typename Op, typename ReleaseHandler,
           typename ForwardIterator, typename... ForwardIterators>
-inline void parallel_loop_generic(const execution::parallel_policy<W>& policy,
-                                  Op                                   op,
-                                  ReleaseHandler                       rh,
-                                  ForwardIterator                      first,
-                                  ForwardIterator                      last,
-                                  ForwardIterators...                  firsts) {
+inline double parallel_loop_generic(const execution::parallel_policy<W>& policy,
+                                    Op                                   op,
+                                    ReleaseHandler                       rh,
+                                    ForwardIterator                      first,
+                                    ForwardIterator                      last,
+                                    ForwardIterators...                  firsts) {
   ori::poll();
 
   // for immediately executing cross-worker tasks in ADWS
@@ -28,14 +52,29 @@ inline void parallel_loop_generic(const execution::parallel_policy<W>& policy,
             [&](ori::release_handler rh_) { ori::acquire(rh); ori::acquire(rh_); });
 
   std::size_t d = std::distance(first, last);
+  double cost = 0;
+
+  if (policy.lazy_split) {
+    // Process the range serially in chunks until the scheduler requests more parallelism
+    while (d > policy.cutoff_count && !ito::should_split()) {
+      std::size_t n = std::min(d, policy.checkout_count);
+      cost += execution::internal::measure_cost(policy, [&] {
+        loop_leaf(execution::internal::to_sequenced_policy(policy),
+                  op, first, std::next(first, n), firsts...);
+      });
+      first = std::next(first, n);
+      ((firsts = std::next(firsts, n)), ...);
+      d -= n;
+      ori::poll();
+    }
+  }
+
   if (d <= policy.cutoff_count) {
-    for_each_aux(
-        execution::internal::to_sequenced_policy(policy),
-        [&](auto&&... refs) {
-          op(std::forward<decltype(refs)>(refs)...);
-        },
-        first, last, firsts...);
-    return;
+    cost += execution::internal::measure_cost(policy, [&] {
+      loop_leaf(execution::internal::to_sequenced_policy(policy),
+                op, first, last, firsts...);
+    });
+    return cost;
   }
 
   auto mid = std::next(first, d / 2);
@@ -45,20 +84,21 @@ inline void parallel_loop_generic(const execution::parallel_policy<W>& policy,
 
   auto&& [p1, p2] = execution::internal::get_child_policies(policy);
 
-  ito::thread<void> th(
+  ito::thread<double> th(
+      policy.fork_policy,
       ito::with_callback, [=] { ori::acquire(rh); }, [] { ori::release(); },
       execution::internal::get_workhint(policy),
       [=, p1 = p1] {
-        parallel_loop_generic(p1, op, rh, first, mid, firsts...);
+        return parallel_loop_generic(p1, op, rh, first, mid, firsts...);
       });
 
-  parallel_loop_generic(p2, op, rh, mid, last, std::next(firsts, d / 2)...);
+  double c2 = parallel_loop_generic(p2, op, rh, mid, last, std::next(firsts, d / 2)...);
 
   if (!th.serialized()) {
     ori::release();
   }
 
-  th.join();
+  double c1 = th.join();
 
   ito::task_group_end([] { ori::release(); }, [] { ori::acquire(); });
 
@@ -66,6 +106,10 @@ inline void parallel_loop_generic(const execution::parallel_policy<W>& policy,
   if (!th.serialized()) {
     ori::acquire();
   }
+
+  execution::internal::set_learned_workhint(policy, c1, c2);
+
+  return cost + c1 + c2;
 }
 
 template <typename Op, typename ForwardIterator, typename... ForwardIterators>
@@ -75,12 +119,8 @@ inline void loop_generic(const execution::sequenced_policy& policy,
                          ForwardIterator                    last,
                          ForwardIterators...                firsts) {
   execution::internal::assert_policy(policy);
-  for_each_aux(
-      execution::internal::to_sequenced_policy(policy),
-      [&](auto&&... refs) {
-        op(std::forward<decltype(refs)>(refs)...);
-      },
-      first, last, firsts...);
+  loop_leaf(execution::internal::to_sequenced_policy(policy),
+            op, first, last, firsts...);
 }
 
 template <typename W, typename Op, typename ForwardIterator, typename... ForwardIterators>
@@ -94,6 +134,100 @@ inline void loop_generic(const execution::parallel_policy<W>& policy,
   parallel_loop_generic(policy, op, rh, first, last, firsts...);
 }
 
+// Returns the position of the first elements for which `pred` returns true (or `offset + d` if
+// not found). Once found, the tasks for the later positions are cancelled.
+template <typename W, typename Predicate, typename ReleaseHandler,
+          typename ForwardIterator, typename... ForwardIterators>
+inline std::size_t parallel_find_generic(const execution::parallel_policy<W>& policy,
+                                         Predicate                            pred,
+                                         ito::cancel_handler                  ch,
+                                         std::size_t                          offset,
+                                         ReleaseHandler                       rh,
+                                         ForwardIterator                      first,
+                                         ForwardIterator                      last,
+                                         ForwardIterators...                  firsts) {
+  ori::poll();
+
+  // for immediately executing cross-worker tasks in ADWS
+  ito::poll([] { return ori::release_lazy(); },
+            [&](ori::release_handler rh_) { ori::acquire(rh); ori::acquire(rh_); });
+
+  std::size_t d = std::distance(first, last);
+
+  // Skip the whole task if an element is already found at an earlier position
+  if (ito::is_cancelled(ch, offset)) {
+    return offset + d;
+  }
+
+  if (d <= policy.cutoff_count) {
+    std::size_t i = find_aux(
+        execution::internal::to_sequenced_policy(policy),
+        pred,
+        [&](std::size_t i) { return i > 0 && ito::is_cancelled(ch, offset + i); },
+        first, last, firsts...);
+    if (i < d) {
+      ito::cancel(ch, offset + i + 1);
+    }
+    return offset + i;
+  }
+
+  auto mid = std::next(first, d / 2);
+
+  ito::task_group_data tgdata;
+  ito::task_group_begin(&tgdata);
+
+  auto&& [p1, p2] = execution::internal::get_child_policies(policy);
+
+  ito::thread<std::size_t> th(
+      policy.fork_policy,
+      ito::with_callback, [=] { ori::acquire(rh); }, [] { ori::release(); },
+      execution::internal::get_workhint(policy),
+      [=, p1 = p1] {
+        return parallel_find_generic(p1, pred, ch, offset, rh, first, mid, firsts...);
+      });
+
+  std::size_t i2 = parallel_find_generic(p2, pred, ch, offset + d / 2, rh,
+                                         mid, last, std::next(firsts, d / 2)...);
+
+  if (!th.serialized()) {
+    ori::release();
+  }
+
+  std::size_t i1 = th.join();
+
+  ito::task_group_end([] { ori::release(); }, [] { ori::acquire(); });
+
+  if (!th.serialized()) {
+    ori::acquire();
+  }
+
+  return (i1 < offset + d / 2) ? i1 : i2;
+}
+
+template <typename Predicate, typename ForwardIterator, typename... ForwardIterators>
+inline std::size_t find_generic(const execution::sequenced_policy& policy,
+                                Predicate                          pred,
+                                ForwardIterator                    first,
+                                ForwardIterator                    last,
+                                ForwardIterators...                firsts) {
+  execution::internal::assert_policy(policy);
+  return find_aux(policy, pred, [](std::size_t) { return false; }, first, last, firsts...);
+}
+
+template <typename W, typename Predicate, typename ForwardIterator, typename... ForwardIterators>
+inline std::size_t find_generic(const execution::parallel_policy<W>& policy,
+                                Predicate                            pred,
+                                ForwardIterator                      first,
+                                ForwardIterator                      last,
+                                ForwardIterators...                  firsts) {
+  execution::internal::assert_policy(policy);
+  auto ch = ito::cancel_scope_begin();
+  auto rh = ori::release_lazy();
+  std::size_t i = parallel_find_generic(policy, pred, ch, 0, rh, first, last, firsts...);
+  ito::cancel_scope_end(ch);
+  return i;
+}
+
 }
 
 /**
@@ -523,12 +657,238 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_loop] parallel for_each") {
         make_global_iterator(p2 + n, checkout_mode::read_write),
         [=](int& y) { y *= 2; });
 
+    for_each(
+        execution::par.with_fork_policy(ito::fork_policy::help_first),
+        count_iterator<int>(0),
+        count_iterator<int>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](int i, int y) { ITYR_CHECK(y == i * 4); });
+
+    for_each(
+        execution::par_auto,
+        count_iterator<int>(0),
+        count_iterator<int>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](int i, int y) { ITYR_CHECK(y == i * 4); });
+
+    for_each(
+        execution::parallel_policy(100).with_lazy_split(),
+        make_global_iterator(p1    , checkout_mode::read),
+        make_global_iterator(p1 + n, checkout_mode::read),
+        make_global_iterator(p2    , checkout_mode::read),
+        [=](int x, int y) { ITYR_CHECK(y == x * 4); });
+
     for_each(
         execution::par,
         count_iterator<int>(0),
         count_iterator<int>(n),
         make_global_iterator(p2, checkout_mode::read),
         [=](int i, int y) { ITYR_CHECK(y == i * 4); });
+
+    for_each(
+        execution::sequenced_policy(100).with_pipeline_depth(2),
+        make_global_iterator(p1    , checkout_mode::read),
+        make_global_iterator(p1 + n, checkout_mode::read),
+        make_global_iterator(p2    , checkout_mode::read_write),
+        [=](int x, int& y) { y += x; });
+
+    for_each(
+        execution::parallel_policy(1000, 100).with_pipeline_depth(1),
+        count_iterator<int>(0),
+        count_iterator<int>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](int i, int y) { ITYR_CHECK(y == i * 5); });
+
+    for_each(
+        execution::parallel_policy(1000, 300).with_pipeline_depth(4),
+        make_global_iterator(p1    , checkout_mode::read),
+        make_global_iterator(p1 + n, checkout_mode::read),
+        make_global_iterator(p2    , checkout_mode::write),
+        [=](int x, int& y) { y = x + 1; });
+
+    for_each(
+        execution::par,
+        count_iterator<int>(0),
+        count_iterator<int>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](int i, int y) { ITYR_CHECK(y == i + 1); });
+  });
+
+  ori::free_coll(p1);
+  ori::free_coll(p2);
+
+  ori::fini();
+  ito::fini();
+}
+
+namespace internal {
+
+template <typename ExecutionPolicy, typename Op, typename ForwardIterator, typename... ForwardIterators>
+inline void loop_chunk_generic(const ExecutionPolicy& policy,
+                               Op                     op,
+                               ForwardIterator        first,
+                               ForwardIterator        last,
+                               ForwardIterators...    firsts) {
+  auto range_op = [=](std::size_t n, auto first_, auto... firsts_) {
+    op(first_, std::next(first_, n), firsts_...);
+  };
+  loop_generic(policy, chunk_op<decltype(range_op)>{range_op}, first, last, firsts...);
+}
+
+}
+
+/**
+ * @brief Apply an operator to each chunk of a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param op     Operator for each chunk in the range.
+ *
+ * This function is similar to `ityr::for_each()`, but the operator `op` is called for each chunk
+ * of the range, rather than for each element. The operator `op` should accept two arguments
+ * `(first_, last_)`, which represent a subrange of `[first, last)`.
+ *
+ * If global iterators are given (by `ityr::make_global_iterator`), each chunk is automatically
+ * checked out with the specified mode, and raw pointers to the checked-out contiguous region
+ * are passed to `op`. The chunk size is at most `checkout_count` of the execution policy.
+ * Otherwise, each leaf task (of at most `cutoff_count` elements if parallel) is passed as a chunk.
+ * This allows leaf loops to be vectorized by the compiler or to be written with SIMD intrinsics.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::for_each_chunk(ityr::execution::par,
+ *                      ityr::make_global_iterator(v1.begin(), ityr::checkout_mode::read_write),
+ *                      ityr::make_global_iterator(v1.end()  , ityr::checkout_mode::read_write),
+ *                      [](int* first, int* last) {
+ *                        for (int* p = first; p != last; p++) (*p)++;
+ *                      });
+ * // v1 = {2, 3, 4, 5, 6}
+ * ```
+ *
+ * @see `ityr::for_each()`
+ * @see `ityr::transform_reduce_chunk()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename Op>
+inline void for_each_chunk(const ExecutionPolicy& policy,
+                           ForwardIterator        first,
+                           ForwardIterator        last,
+                           Op                     op) {
+  internal::loop_chunk_generic(policy, op, first, last);
+}
+
+/**
+ * @brief Apply an operator to each chunk of ranges.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first1 1st begin iterator.
+ * @param last1  1st end iterator.
+ * @param first2 2nd begin iterator.
+ * @param op     Operator for each chunk in the ranges.
+ *
+ * The operator `op` should accept three arguments `(first1_, last1_, first2_)`, where `first2_`
+ * is the begin iterator of the corresponding chunk in the 2nd range.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2 = {1, 2, 3, 4, 5};
+ * ityr::for_each_chunk(ityr::execution::par,
+ *                      ityr::make_global_iterator(v1.begin(), ityr::checkout_mode::read),
+ *                      ityr::make_global_iterator(v1.end()  , ityr::checkout_mode::read),
+ *                      ityr::make_global_iterator(v2.begin(), ityr::checkout_mode::read_write),
+ *                      [](const int* first1, const int* last1, int* first2) {
+ *                        for (std::size_t i = 0; i < std::size_t(last1 - first1); i++) {
+ *                          first2[i] += first1[i];
+ *                        }
+ *                      });
+ * // v2 = {2, 4, 6, 8, 10}
+ * ```
+ *
+ * @see `ityr::for_each()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename Op>
+inline void for_each_chunk(const ExecutionPolicy& policy,
+                           ForwardIterator1       first1,
+                           ForwardIterator1       last1,
+                           ForwardIterator2       first2,
+                           Op                     op) {
+  internal::loop_chunk_generic(policy, op, first1, last1, first2);
+}
+
+/**
+ * @brief Apply an operator to each chunk of ranges.
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+          typename ForwardIterator3, typename Op>
+inline void for_each_chunk(const ExecutionPolicy& policy,
+                           ForwardIterator1       first1,
+                           ForwardIterator1       last1,
+                           ForwardIterator2       first2,
+                           ForwardIterator3       first3,
+                           Op                     op) {
+  internal::loop_chunk_generic(policy, op, first1, last1, first2, first3);
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_loop] for_each_chunk") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p1 = ori::malloc_coll<long>(n);
+  ori::global_ptr<long> p2 = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    for_each_chunk(
+        execution::parallel_policy(1000, 100),
+        make_global_iterator(p1    , checkout_mode::write),
+        make_global_iterator(p1 + n, checkout_mode::write),
+        count_iterator<long>(0),
+        [=](long* first, long* last, count_iterator<long> it) {
+          ITYR_CHECK(last - first <= 100);
+          for (long i = 0; i < last - first; i++) {
+            first[i] = *it + i;
+          }
+        });
+
+    for_each_chunk(
+        execution::sequenced_policy(300).with_pipeline_depth(1),
+        make_global_iterator(p1    , checkout_mode::read),
+        make_global_iterator(p1 + n, checkout_mode::read),
+        make_global_iterator(p2    , checkout_mode::write),
+        [=](const long* first1, const long* last1, long* first2) {
+          for (long i = 0; i < last1 - first1; i++) {
+            first2[i] = first1[i] * 2;
+          }
+        });
+
+    for_each_chunk(
+        execution::par,
+        count_iterator<long>(0),
+        count_iterator<long>(n),
+        make_global_iterator(p1, checkout_mode::read),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](count_iterator<long> first, count_iterator<long> last, const long* it1, const long* it2) {
+          for (; first != last; (++first, ++it1, ++it2)) {
+            ITYR_CHECK(*it1 == *first);
+            ITYR_CHECK(*it2 == *first * 2);
+          }
+        });
+
+    // Without automatic checkout, each leaf range is passed as a chunk
+    long n_chunks = 0;
+    long count = 0;
+    for_each_chunk(
+        execution::seq,
+        count_iterator<long>(0),
+        count_iterator<long>(n),
+        [&](count_iterator<long> first, count_iterator<long> last) {
+          n_chunks++;
+          count += last - first;
+        });
+    ITYR_CHECK(n_chunks == 1);
+    ITYR_CHECK(count == n);
   });
 
   ori::free_coll(p1);
@@ -14,6 +14,31 @@ namespace ityr {
 
 namespace internal {
 
+template <typename AccumulateOp, typename Accumulator,
+          typename ForwardIterator, typename... ForwardIterators>
+inline void reduce_leaf(const execution::sequenced_policy& policy,
+                        const AccumulateOp&                accumulate_op,
+                        Accumulator&                       acc,
+                        ForwardIterator                    first,
+                        ForwardIterator                    last,
+                        ForwardIterators...                firsts) {
+  if constexpr (is_chunk_op_v<AccumulateOp>) {
+    for_each_chunk_aux(
+        policy,
+        [&](auto&&... args) {
+          accumulate_op.op(acc, std::forward<decltype(args)>(args)...);
+        },
+        first, last, firsts...);
+  } else {
+    for_each_aux(
+        policy,
+        [&](auto&&... refs) {
+          accumulate_op(acc, std::forward<decltype(refs)>(refs)...);
+        },
+        first, last, firsts...);
+  }
+}
+
 template <typename W, typename AccumulateOp, typename CombineOp, typename Reducer,
           typename ReleaseHandler, typename ForwardIterator, typename... ForwardIterators>
 inline typename Reducer::accumulator_type
@@ -35,13 +60,23 @@ parallel_reduce_generic(const execution::parallel_policy<W>& policy,
             [&](ori::release_handler rh_) { ori::acquire(rh); ori::acquire(rh_); });
 
   std::size_t d = std::distance(first, last);
+
+  if (policy.lazy_split) {
+    // Process the range serially in chunks until the scheduler requests more parallelism
+    while (d > policy.cutoff_count && !ito::should_split()) {
+      std::size_t n = std::min(d, policy.checkout_count);
+      reduce_leaf(execution::internal::to_sequenced_policy(policy),
+                  accumulate_op, acc, first, std::next(first, n), firsts...);
+      first = std::next(first, n);
+      ((firsts = std::next(firsts, n)), ...);
+      d -= n;
+      ori::poll();
+    }
+  }
+
   if (d <= policy.cutoff_count) {
-    for_each_aux(
-        execution::internal::to_sequenced_policy(policy),
-        [&](auto&&... refs) {
-          accumulate_op(acc, std::forward<decltype(refs)>(refs)...);
-        },
-        first, last, firsts...);
+    reduce_leaf(execution::internal::to_sequenced_policy(policy),
+                accumulate_op, acc, first, last, firsts...);
     return std::move(acc);
   }
 
@@ -53,6 +88,7 @@ parallel_reduce_generic(const execution::parallel_policy<W>& policy,
   auto&& [p1, p2] = execution::internal::get_child_policies(policy);
 
   ito::thread<acc_t> th(
+      policy.fork_policy,
       ito::with_callback, [=] { ori::acquire(rh); }, [] { ori::release(); },
       execution::internal::get_workhint(policy),
       [=, p1 = p1, acc = std::move(acc)]() mutable {
@@ -100,12 +136,8 @@ reduce_generic(const execution::sequenced_policy&   policy,
                ForwardIterator                      last,
                ForwardIterators...                  firsts) {
   execution::internal::assert_policy(policy);
-  for_each_aux(
-      execution::internal::to_sequenced_policy(policy),
-      [&](auto&&... refs) {
-        accumulate_op(acc, std::forward<decltype(refs)>(refs)...);
-      },
-      first, last, firsts...);
+  reduce_leaf(execution::internal::to_sequenced_policy(policy),
+              accumulate_op, acc, first, last, firsts...);
   return std::move(acc);
 }
 
@@ -429,6 +461,27 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] reduce and transform_reduce") {
     ITYR_CHECK(r == 0);
   }
 
+  ITYR_SUBCASE("lazy split") {
+    long n = 100000;
+    long r1 = ito::root_exec([=] {
+      return reduce(
+          execution::par_auto,
+          count_iterator<long>(0),
+          count_iterator<long>(n));
+    });
+    ITYR_CHECK(r1 == n * (n - 1) / 2);
+
+    long r2 = ito::root_exec([=] {
+      return transform_reduce(
+          execution::parallel_policy(100).with_lazy_split(),
+          count_iterator<long>(0),
+          count_iterator<long>(n),
+          reducer::plus<long>{},
+          [](long x) { return x * x; });
+    });
+    ITYR_CHECK(r2 == n * (n - 1) * (2 * n - 1) / 6);
+  }
+
   ori::fini();
   ito::fini();
 }
@@ -467,6 +520,15 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] parallel reduce with global_ptr
     ITYR_CHECK(r == n * (n - 1) / 2);
   }
 
+  ITYR_SUBCASE("pipelined checkout") {
+    long r = ito::root_exec([=] {
+      return reduce(
+          execution::parallel_policy(1000, 100).with_pipeline_depth(2),
+          p, p + n);
+    });
+    ITYR_CHECK(r == n * (n - 1) / 2);
+  }
+
   ITYR_SUBCASE("without auto checkout") {
     long r = ito::root_exec([=] {
       return transform_reduce(
@@ -517,6 +579,333 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] parallel reduce with global_ptr
   ito::fini();
 }
 
+/**
+ * @brief Calculate reduction over partial results computed for each chunk of a range.
+ *
+ * @param policy             Execution policy (`ityr::execution`).
+ * @param first              Begin iterator.
+ * @param last               End iterator.
+ * @param reducer            Reducer object (`ityr::reducer`).
+ * @param chunk_transform_op Operator to compute a partial result for each chunk.
+ *
+ * @return The reduced result.
+ *
+ * This function is similar to `ityr::transform_reduce()`, but `chunk_transform_op` is called for
+ * each chunk of the range, rather than for each element. It should accept two arguments
+ * `(first_, last_)`, which represent a subrange of `[first, last)`, and return the partial result
+ * for the chunk, which is then reduced by `reducer`.
+ *
+ * If global pointers are provided as iterators, they are automatically checked out with the read-only
+ * mode and raw pointers to the checked-out contiguous region are passed to `chunk_transform_op`.
+ * The chunk size is at most `checkout_count` of the execution policy.
+ * This allows the partial result to be accumulated in a local variable in a vectorizable loop.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * int r = ityr::transform_reduce_chunk(ityr::execution::par, v1.begin(), v1.end(), ityr::reducer::plus<int>{},
+ *                                      [](const int* first, const int* last) {
+ *                                        int s = 0;
+ *                                        for (const int* p = first; p != last; p++) s += *p * *p;
+ *                                        return s;
+ *                                      });
+ * // r = 55
+ * ```
+ *
+ * @see `ityr::transform_reduce()`
+ * @see `ityr::for_each_chunk()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator,
+          typename Reducer, typename ChunkTransformOp>
+inline typename Reducer::accumulator_type
+transform_reduce_chunk(const ExecutionPolicy& policy,
+                       ForwardIterator        first,
+                       ForwardIterator        last,
+                       Reducer                reducer,
+                       ChunkTransformOp       chunk_transform_op) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    return transform_reduce_chunk(
+        policy,
+        internal::convert_to_global_iterator(first, checkout_mode::read),
+        internal::convert_to_global_iterator(last , checkout_mode::read),
+        reducer,
+        chunk_transform_op);
+
+  } else {
+    auto accumulate_op = [=](auto&& acc, std::size_t n, auto first_) {
+      reducer(std::forward<decltype(acc)>(acc), chunk_transform_op(first_, std::next(first_, n)));
+    };
+
+    auto combine_op = [=](auto&& acc1, auto&& acc2,
+                          ForwardIterator, ForwardIterator, ForwardIterator) {
+      reducer(std::forward<decltype(acc1)>(acc1), std::forward<decltype(acc2)>(acc2));
+    };
+
+    return internal::reduce_generic(policy, internal::chunk_op<decltype(accumulate_op)>{accumulate_op},
+                                    combine_op, reducer, reducer(), first, last);
+  }
+}
+
+/**
+ * @brief Calculate reduction over partial results computed for each chunk of two ranges.
+ *
+ * @param policy             Execution policy (`ityr::execution`).
+ * @param first1             1st begin iterator.
+ * @param last1              1st end iterator.
+ * @param first2             2nd begin iterator.
+ * @param reducer            Reducer object (`ityr::reducer`).
+ * @param chunk_transform_op Operator to compute a partial result for each chunk.
+ *
+ * @return The reduced result.
+ *
+ * `chunk_transform_op` should accept three arguments `(first1_, last1_, first2_)`, where `first2_`
+ * is the begin iterator of the corresponding chunk in the 2nd range.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<double> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<double> v2 = {2, 3, 4, 5, 6};
+ * double r = ityr::transform_reduce_chunk(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                                         ityr::reducer::plus<double>{},
+ *                                         [](const double* first1, const double* last1, const double* first2) {
+ *                                           double s = 0;
+ *                                           for (std::size_t i = 0; i < std::size_t(last1 - first1); i++) {
+ *                                             s += first1[i] * first2[i];
+ *                                           }
+ *                                           return s;
+ *                                         });
+ * // r = 70
+ * ```
+ *
+ * @see `ityr::transform_reduce()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+          typename Reducer, typename ChunkTransformOp>
+inline typename Reducer::accumulator_type
+transform_reduce_chunk(const ExecutionPolicy& policy,
+                       ForwardIterator1       first1,
+                       ForwardIterator1       last1,
+                       ForwardIterator2       first2,
+                       Reducer                reducer,
+                       ChunkTransformOp       chunk_transform_op) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator1> ||
+                ori::is_global_ptr_v<ForwardIterator2>) {
+    return transform_reduce_chunk(
+        policy,
+        internal::convert_to_global_iterator(first1, checkout_mode::read),
+        internal::convert_to_global_iterator(last1 , checkout_mode::read),
+        internal::convert_to_global_iterator(first2, checkout_mode::read),
+        reducer,
+        chunk_transform_op);
+
+  } else {
+    auto accumulate_op = [=](auto&& acc, std::size_t n, auto first1_, auto first2_) {
+      reducer(std::forward<decltype(acc)>(acc),
+              chunk_transform_op(first1_, std::next(first1_, n), first2_));
+    };
+
+    auto combine_op = [=](auto&& acc1, auto&& acc2,
+                          ForwardIterator1, ForwardIterator1, ForwardIterator1, ForwardIterator2) {
+      reducer(std::forward<decltype(acc1)>(acc1), std::forward<decltype(acc2)>(acc2));
+    };
+
+    return internal::reduce_generic(policy, internal::chunk_op<decltype(accumulate_op)>{accumulate_op},
+                                    combine_op, reducer, reducer(), first1, last1, first2);
+  }
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] transform_reduce_chunk") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    for_each(
+        execution::par,
+        make_global_iterator(p    , checkout_mode::write),
+        make_global_iterator(p + n, checkout_mode::write),
+        count_iterator<long>(0),
+        [](long& v, long i) { v = i; });
+  });
+
+  ITYR_SUBCASE("parallel") {
+    long r = ito::root_exec([=] {
+      return transform_reduce_chunk(
+          execution::parallel_policy(1000, 100),
+          p, p + n,
+          reducer::plus<long>{},
+          [](const long* first, const long* last) {
+            ITYR_CHECK(last - first <= 100);
+            long s = 0;
+            for (const long* it = first; it != last; it++) {
+              s += *it;
+            }
+            return s;
+          });
+    });
+    ITYR_CHECK(r == n * (n - 1) / 2);
+  }
+
+  ITYR_SUBCASE("serial") {
+    long r = ito::root_exec([=] {
+      return transform_reduce_chunk(
+          execution::sequenced_policy(100).with_pipeline_depth(2),
+          p, p + n,
+          reducer::plus<long>{},
+          [](const long* first, const long* last) {
+            long s = 0;
+            for (const long* it = first; it != last; it++) {
+              s += *it;
+            }
+            return s;
+          });
+    });
+    ITYR_CHECK(r == n * (n - 1) / 2);
+  }
+
+  ITYR_SUBCASE("two ranges") {
+    long r = ito::root_exec([=] {
+      return transform_reduce_chunk(
+          execution::par,
+          count_iterator<long>(0), count_iterator<long>(n),
+          p,
+          reducer::max<long>{},
+          [](count_iterator<long> first1, count_iterator<long> last1, const long* first2) {
+            long m = std::numeric_limits<long>::lowest();
+            for (long i = 0; i < last1 - first1; i++) {
+              m = std::max(m, first2[i] - first1[i]);
+            }
+            return m;
+          });
+    });
+    ITYR_CHECK(r == 0);
+  }
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
+namespace internal {
+
+template <bool Exclusive, typename Reducer, typename UnaryTransformOp>
+inline auto make_scan_accumulate_op(Reducer reducer, UnaryTransformOp unary_transform_op) {
+  if constexpr (Exclusive) {
+    return [=](auto&& acc, const auto& r1, auto&& d) {
+      // copy the transformed value first, as the input and output ranges can overlap
+      auto v = unary_transform_op(r1);
+      d = acc;
+      reducer(acc, std::move(v));
+    };
+  } else {
+    return [=](auto&& acc, const auto& r1, auto&& d) {
+      reducer(acc, unary_transform_op(r1));
+      d = acc;
+    };
+  }
+}
+
+template <bool Exclusive, typename Reducer, typename UnaryTransformOp,
+          typename ForwardIterator1, typename ForwardIteratorD>
+inline void scan_generic(const execution::sequenced_policy&   policy,
+                         Reducer                              reducer,
+                         UnaryTransformOp                     unary_transform_op,
+                         typename Reducer::accumulator_type&& init,
+                         ForwardIterator1                     first1,
+                         ForwardIterator1                     last1,
+                         ForwardIteratorD                     first_d) {
+  execution::internal::assert_policy(policy);
+  auto accumulate_op = make_scan_accumulate_op<Exclusive>(reducer, unary_transform_op);
+  reduce_leaf(policy, accumulate_op, init, first1, last1, first_d);
+}
+
+// Blocked reduce-then-scan: (1) the reduction of each block is computed in parallel,
+// (2) the block sums are exclusively scanned in place (serially, as there are only n / B of them),
+// and (3) each block is scanned in parallel, starting from its prefix. The total work is O(n)
+// regardless of how tasks are scheduled, and each input element is read twice.
+template <bool Exclusive, typename W, typename Reducer, typename UnaryTransformOp,
+          typename ForwardIterator1, typename ForwardIteratorD>
+inline void scan_generic(const execution::parallel_policy<W>& policy,
+                         Reducer                              reducer,
+                         UnaryTransformOp                     unary_transform_op,
+                         typename Reducer::accumulator_type&& init,
+                         ForwardIterator1                     first1,
+                         ForwardIterator1                     last1,
+                         ForwardIteratorD                     first_d) {
+  using acc_t        = typename Reducer::accumulator_type;
+  using value_type_d = typename std::iterator_traits<ForwardIteratorD>::value_type;
+
+  execution::internal::assert_policy(policy);
+
+  // Blocks are at least as large as leaf tasks and cache blocks of the output range,
+  // so that the number of block sums is much smaller than the number of elements
+  std::size_t n = std::distance(first1, last1);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(value_type_d));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    scan_generic<Exclusive>(seq_policy, reducer, unary_transform_op, std::move(init),
+                            first1, last1, first_d);
+    return;
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<acc_t> sums = ori::malloc<acc_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_construct_iterator(sums),
+      [=](std::size_t i, acc_t* s) {
+        auto accumulate_op = [=](auto&& acc, const auto& r1) {
+          reducer(acc, unary_transform_op(r1));
+        };
+        std::size_t d = std::min(n - i * b, b);
+        auto first1_ = std::next(first1, i * b);
+        acc_t acc = reducer();
+        reduce_leaf(seq_policy, accumulate_op, acc, first1_, std::next(first1_, d));
+        new (s) acc_t(std::move(acc));
+      });
+
+  acc_t acc = std::move(init);
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(sums    , checkout_mode::read_write),
+      make_global_iterator(sums + m, checkout_mode::read_write),
+      [&](acc_t& s) {
+        acc_t v = std::move(s);
+        s = acc;
+        reducer(acc, std::move(v));
+      });
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_destruct_iterator(sums),
+      [=](std::size_t i, acc_t* s) {
+        auto accumulate_op = make_scan_accumulate_op<Exclusive>(reducer, unary_transform_op);
+        std::size_t d = std::min(n - i * b, b);
+        auto first1_ = std::next(first1, i * b);
+        reduce_leaf(seq_policy, accumulate_op, *s, first1_, std::next(first1_, d),
+                    std::next(first_d, i * b));
+        std::destroy_at(s);
+      });
+
+  ori::free(sums, m);
+}
+
+}
+
 /**
  * @brief Calculate a prefix sum (inclusive scan) while transforming each element.
  *
@@ -547,6 +936,12 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] parallel reduce with global_ptr
  *
  * Overlapping regions can be specified for the input and output ranges.
  *
+ * With a parallel policy, the range is divided into blocks of at least `cutoff_count` elements
+ * (and at least one cache block of the output range), and the prefix sum is calculated in two
+ * passes: the sum of each block is computed in parallel, and then each block is scanned in
+ * parallel from its prefix. Thus, the input range is read twice, and `unary_transform_op` is
+ * applied twice to each element.
+ *
  * Unlike the standard `std::transform_inclusive_scan()`, Itoyori's `ityr::transform_inclusive_scan()`
  * requires a `reducer` as `ityr::reduce()` does.
  *
@@ -591,38 +986,8 @@ transform_inclusive_scan(const ExecutionPolicy&               policy,
         std::move(init));
 
   } else {
-    auto accumulate_op = [=](auto&& acc, const auto& r1, auto&& d) {
-      reducer(acc, unary_transform_op(r1));
-      d = acc;
-    };
-
-    // TODO: more efficient scan implementation
-    auto combine_op = [=](auto&&           acc1,
-                          auto&&           acc2,
-                          ForwardIterator1 first_,
-                          ForwardIterator1 mid_,
-                          ForwardIterator1 last_,
-                          ForwardIteratorD first_d_) {
-      // Add the left accumulator `acc1` to the right half of the region
-      auto dm = std::distance(first_, mid_);
-      auto dl = std::distance(first_, last_);
-      if constexpr (!is_global_iterator_v<ForwardIteratorD>) {
-        for_each(policy, std::next(first_d_, dm), std::next(first_d_, dl),
-                 [=](auto&& acc_r) { reducer(acc1, acc_r); });
-      } else if constexpr (std::is_same_v<typename ForwardIteratorD::mode, checkout_mode::no_access_t>) {
-        for_each(policy, std::next(first_d_, dm), std::next(first_d_, dl),
-                 [=](auto&& acc_r) { reducer(acc1, acc_r); });
-      } else {
-        // &*: convert global_iterator -> global_ref -> global_ptr
-        auto fd = make_global_iterator(&*first_d_, checkout_mode::read_write);
-        for_each(policy, std::next(fd, dm), std::next(fd, dl),
-                 [=](auto&& acc_r) { reducer(acc1, acc_r); });
-      }
-      reducer(std::forward<decltype(acc1)>(acc1), std::forward<decltype(acc2)>(acc2));
-    };
-
-    internal::reduce_generic(policy, accumulate_op, combine_op, reducer,
-                             std::move(init), first1, last1, first_d);
+    internal::scan_generic<false>(policy, reducer, unary_transform_op, std::move(init),
+                                  first1, last1, first_d);
 
     return std::next(first_d, std::distance(first1, last1));
   }
@@ -805,6 +1170,208 @@ inline ForwardIteratorD inclusive_scan(const ExecutionPolicy& policy,
   return inclusive_scan(policy, first1, last1, first_d, reducer::plus<T>{});
 }
 
+/**
+ * @brief Calculate a prefix sum (exclusive scan) while transforming each element.
+ *
+ * @param policy             Execution policy (`ityr::execution`).
+ * @param first1             Input begin iterator.
+ * @param last1              Input end iterator.
+ * @param first_d            Output begin iterator.
+ * @param reducer            Reducer object (`ityr::reducer`).
+ * @param unary_transform_op Unary operator to transform each element.
+ * @param init               Initial value for the prefix sum.
+ *
+ * @return The end iterator of the output range (`first_d + (last1 - first1)`).
+ *
+ * This function is similar to `ityr::transform_inclusive_scan()`, but the prefix sum is exclusive,
+ * which means that the i-th element of the prefix sum does not include the i-th element in the
+ * input range. That is, the i-th element of the prefix sum is:
+ * `init + f(*first1) + ... + f(*(first1 + i - 1))`, and the first element is `init`.
+ *
+ * Global pointers are automatically checked out as in `ityr::transform_inclusive_scan()`, and
+ * overlapping regions can be specified for the input and output ranges.
+ *
+ * Unlike the standard `std::transform_exclusive_scan()`, Itoyori's `ityr::transform_exclusive_scan()`
+ * requires a `reducer` as `ityr::reduce()` does, and `init` is given after the transform operator.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2(v1.size());
+ * ityr::transform_exclusive_scan(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                                ityr::reducer::plus<int>{}, [](int x) { return x * x; }, 10);
+ * // v2 = {10, 11, 15, 24, 40}
+ * ```
+ *
+ * @see [std::transform_exclusive_scan -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/transform_exclusive_scan)
+ * @see `ityr::exclusive_scan()`
+ * @see `ityr::transform_inclusive_scan()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Reducer, typename UnaryTransformOp>
+inline ForwardIteratorD
+transform_exclusive_scan(const ExecutionPolicy&               policy,
+                         ForwardIterator1                     first1,
+                         ForwardIterator1                     last1,
+                         ForwardIteratorD                     first_d,
+                         Reducer                              reducer,
+                         UnaryTransformOp                     unary_transform_op,
+                         typename Reducer::accumulator_type&& init) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator1> ||
+                ori::is_global_ptr_v<ForwardIteratorD>) {
+    using value_type_d = typename std::iterator_traits<ForwardIteratorD>::value_type;
+    return transform_exclusive_scan(
+        policy,
+        internal::convert_to_global_iterator(first1 , checkout_mode::read),
+        internal::convert_to_global_iterator(last1  , checkout_mode::read),
+        internal::convert_to_global_iterator(first_d, internal::dest_checkout_mode_t<value_type_d>{}),
+        reducer,
+        unary_transform_op,
+        std::move(init));
+
+  } else {
+    internal::scan_generic<true>(policy, reducer, unary_transform_op, std::move(init),
+                                 first1, last1, first_d);
+
+    return std::next(first_d, std::distance(first1, last1));
+  }
+}
+
+/**
+ * @brief Calculate a prefix sum (exclusive scan) while transforming each element.
+ *
+ * @param policy             Execution policy (`ityr::execution`).
+ * @param first1             Input begin iterator.
+ * @param last1              Input end iterator.
+ * @param first_d            Output begin iterator.
+ * @param reducer            Reducer object (`ityr::reducer`).
+ * @param unary_transform_op Unary operator to transform each element.
+ *
+ * @return The end iterator of the output range (`first_d + (last1 - first1)`).
+ *
+ * Equivalent to `ityr::transform_exclusive_scan(policy, first1, last1, first_d, reducer, unary_transform_op, reducer())`.
+ *
+ * @see `ityr::transform_exclusive_scan()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Reducer, typename UnaryTransformOp>
+inline ForwardIteratorD transform_exclusive_scan(const ExecutionPolicy& policy,
+                                                 ForwardIterator1       first1,
+                                                 ForwardIterator1       last1,
+                                                 ForwardIteratorD       first_d,
+                                                 Reducer                reducer,
+                                                 UnaryTransformOp       unary_transform_op) {
+  return transform_exclusive_scan(policy, first1, last1, first_d, reducer,
+                                  unary_transform_op, reducer());
+}
+
+/**
+ * @brief Calculate a prefix sum (exclusive scan).
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param reducer Reducer object (`ityr::reducer`).
+ * @param init    Initial value for the prefix sum.
+ *
+ * @return The end iterator of the output range (`first_d + (last1 - first1)`).
+ *
+ * This function calculates an exclusive prefix sum over the elements in the input range
+ * `[first1, last1)`. That is, the i-th element of the prefix sum is:
+ * `init + *first1 + ... + *(first1 + i - 1)`, and the first element is `init`.
+ * The calculated prefix sum is stored in the output range `[first_d, first_d + (last1 - first1))`.
+ *
+ * Global pointers are automatically checked out as in `ityr::inclusive_scan()`, and overlapping
+ * regions can be specified for the input and output ranges.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2(v1.size());
+ * ityr::exclusive_scan(ityr::execution::par, v1.begin(), v1.end(), v2.begin(),
+ *                      ityr::reducer::plus<int>{}, 10);
+ * // v2 = {10, 11, 13, 16, 20}
+ * ```
+ *
+ * @see [std::exclusive_scan -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/exclusive_scan)
+ * @see `ityr::transform_exclusive_scan()`
+ * @see `ityr::inclusive_scan()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Reducer>
+inline ForwardIteratorD
+exclusive_scan(const ExecutionPolicy&               policy,
+               ForwardIterator1                     first1,
+               ForwardIterator1                     last1,
+               ForwardIteratorD                     first_d,
+               Reducer                              reducer,
+               typename Reducer::accumulator_type&& init) {
+  return transform_exclusive_scan(policy, first1, last1, first_d, reducer,
+      [](auto&& r) -> decltype(auto) { return std::forward<decltype(r)>(r); }, std::move(init));
+}
+
+/**
+ * @brief Calculate a prefix sum (exclusive scan).
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param reducer Reducer object (`ityr::reducer`).
+ *
+ * @return The end iterator of the output range (`first_d + (last1 - first1)`).
+ *
+ * Equivalent to `ityr::exclusive_scan(policy, first1, last1, first_d, reducer, reducer())`.
+ *
+ * @see `ityr::exclusive_scan()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD,
+          typename Reducer>
+inline ForwardIteratorD exclusive_scan(const ExecutionPolicy& policy,
+                                       ForwardIterator1       first1,
+                                       ForwardIterator1       last1,
+                                       ForwardIteratorD       first_d,
+                                       Reducer                reducer) {
+  return exclusive_scan(policy, first1, last1, first_d, reducer, reducer());
+}
+
+/**
+ * @brief Calculate a prefix sum (exclusive scan).
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first1  Input begin iterator.
+ * @param last1   Input end iterator.
+ * @param first_d Output begin iterator.
+ *
+ * @return The end iterator of the output range (`first_d + (last1 - first1)`).
+ *
+ * Equivalent to `ityr::exclusive_scan(policy, first1, last1, first_d, ityr::reducer::plus<T>{})`, where
+ * `T` is the value type of the input iterator.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {1, 2, 3, 4, 5};
+ * ityr::global_vector<int> v2(v1.size());
+ * ityr::exclusive_scan(ityr::execution::par, v1.begin(), v1.end(), v2.begin());
+ * // v2 = {0, 1, 3, 6, 10}
+ * ```
+ *
+ * @see `ityr::exclusive_scan()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIteratorD>
+inline ForwardIteratorD exclusive_scan(const ExecutionPolicy& policy,
+                                       ForwardIterator1       first1,
+                                       ForwardIterator1       last1,
+                                       ForwardIteratorD       first_d) {
+  using T = typename std::iterator_traits<ForwardIterator1>::value_type;
+  return exclusive_scan(policy, first1, last1, first_d, reducer::plus<T>{});
+}
+
 ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] inclusive scan") {
   ito::init();
   ori::init();
@@ -824,12 +1391,26 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] inclusive scan") {
     ITYR_CHECK(p2[0].get() == 1);
     ITYR_CHECK(p2[n - 1].get() == n);
 
+    for_each(
+        execution::par,
+        count_iterator<long>(0),
+        count_iterator<long>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](long i, long x) { ITYR_CHECK(x == i + 1); });
+
     auto sum = reduce(
         execution::parallel_policy(100),
         p2, p2 + n);
 
     ITYR_CHECK(sum == n * (n + 1) / 2);
 
+    inclusive_scan(
+        execution::parallel_policy(100).with_lazy_split(),
+        p1, p1 + n, p2);
+
+    ITYR_CHECK(p2[n - 1].get() == n);
+    ITYR_CHECK(reduce(execution::par, p2, p2 + n) == n * (n + 1) / 2);
+
     inclusive_scan(
         execution::parallel_policy(100),
         p1, p1 + n, p2, reducer::multiplies<long>{}, 10);
@@ -852,6 +1433,65 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] inclusive scan") {
   ito::fini();
 }
 
+ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] exclusive scan") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p1 = ori::malloc_coll<long>(n);
+  ori::global_ptr<long> p2 = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    fill(execution::parallel_policy(100),
+         p1, p1 + n, 1);
+
+    exclusive_scan(
+        execution::parallel_policy(100),
+        p1, p1 + n, p2);
+
+    for_each(
+        execution::par,
+        count_iterator<long>(0),
+        count_iterator<long>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](long i, long x) { ITYR_CHECK(x == i); });
+
+    exclusive_scan(
+        execution::sequenced_policy(100),
+        p1, p1 + n, p2, reducer::plus<long>{}, 10);
+
+    ITYR_CHECK(p2[0].get() == 10);
+    ITYR_CHECK(p2[n - 1].get() == 10 + n - 1);
+
+    transform_exclusive_scan(
+        execution::par_auto,
+        count_iterator<long>(0), count_iterator<long>(n), p2,
+        reducer::plus<long>{}, [](long i) { return i * 2; }, 1);
+
+    for_each(
+        execution::par,
+        count_iterator<long>(0),
+        count_iterator<long>(n),
+        make_global_iterator(p2, checkout_mode::read),
+        [=](long i, long x) { ITYR_CHECK(x == 1 + i * (i - 1)); });
+
+    // in place
+    exclusive_scan(
+        execution::parallel_policy(100),
+        p1, p1 + n, p1, reducer::plus<long>{}, 5);
+
+    ITYR_CHECK(p1[0].get() == 5);
+    ITYR_CHECK(p1[n - 1].get() == 5 + n - 1);
+    ITYR_CHECK(reduce(execution::par, p1, p1 + n) == 5 * n + n * (n - 1) / 2);
+  });
+
+  ori::free_coll(p1);
+  ori::free_coll(p2);
+
+  ori::fini();
+  ito::fini();
+}
+
 /**
  * @brief Check if two ranges have equal values.
  *
@@ -864,6 +1504,8 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] inclusive scan") {
  * @return Returns true if `pred` returns true for all pairs of elements in the input ranges
  *         (`[first1, last1)` and `[first2, first2 + (last1 - first1))`).
  *
+ * The remaining elements are not compared once a mismatch is found (see `ityr::find_if()`).
+ *
  * If global pointers are provided as iterators, they are automatically checked out with the read-only
  * mode in the specified granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
  * or `ityr::execution::parallel_policy::checkout_count` if parallel) without explicitly passing them
@@ -889,7 +1531,23 @@ inline bool equal(const ExecutionPolicy& policy,
                   ForwardIterator1       last1,
                   ForwardIterator2       first2,
                   BinaryPredicate        pred) {
-  return transform_reduce(policy, first1, last1, first2, reducer::logical_and{}, pred);
+  if constexpr (ori::is_global_ptr_v<ForwardIterator1> ||
+                ori::is_global_ptr_v<ForwardIterator2>) {
+    return equal(
+        policy,
+        internal::convert_to_global_iterator(first1, checkout_mode::read),
+        internal::convert_to_global_iterator(last1 , checkout_mode::read),
+        internal::convert_to_global_iterator(first2, checkout_mode::read),
+        pred);
+
+  } else {
+    // Stop as soon as a mismatch is found
+    std::size_t n = std::distance(first1, last1);
+    return internal::find_generic(
+        policy,
+        [=](const auto& r1, const auto& r2) { return !pred(r1, r2); },
+        first1, last1, first2) == n;
+  }
 }
 
 /**
@@ -1031,6 +1689,7 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_reduce] equal") {
  * @return Returns true if `comp(*(first + i + 1), *(first + i))` is false for all `i`.
  *
  * This function checks if the given range is sorted with respect to the comparison operator `comp`.
+ * The remaining elements are not checked once an unsorted pair is found (see `ityr::find_if()`).
  *
  * If global pointers are provided as iterators, they are automatically checked out with the read-only
  * mode in the specified granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
@@ -1055,10 +1714,19 @@ inline bool is_sorted(const ExecutionPolicy& policy,
                       ForwardIterator        first,
                       ForwardIterator        last,
                       Compare                comp) {
-  // Check if comp(a(i+1), a(i)) returns false for all i
-  return std::distance(first, last) <= 1 ||
-         transform_reduce(policy, std::next(first), last, first,
-                          reducer::logical_or{}, comp) == false;
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    return is_sorted(
+        policy,
+        internal::convert_to_global_iterator(first, checkout_mode::read),
+        internal::convert_to_global_iterator(last , checkout_mode::read),
+        comp);
+
+  } else {
+    // Check if comp(a(i+1), a(i)) returns false for all i, and stop as soon as it returns true
+    std::size_t n = std::distance(first, last);
+    return n <= 1 ||
+           internal::find_generic(policy, comp, std::next(first), last, first) == n - 1;
+  }
 }
 
 /**
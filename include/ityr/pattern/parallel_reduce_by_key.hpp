@@ -0,0 +1,818 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+
+#include "ityr/common/util.hpp"
+#include "ityr/pattern/count_iterator.hpp"
+#include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_filter.hpp"
+#include "ityr/pattern/parallel_sort.hpp"
+#include "ityr/pattern/reducer.hpp"
+#include "ityr/container/global_vector.hpp"
+
+#if __has_include(<ankerl/unordered_dense.h>)
+#include <ankerl/unordered_dense.h>
+namespace ityr::internal {
+template <typename Key, typename Value>
+using group_map = ankerl::unordered_dense::map<Key, Value>;
+}
+#else
+#include <unordered_map>
+namespace ityr::internal {
+template <typename Key, typename Value>
+using group_map = std::unordered_map<Key, Value>;
+}
+#endif
+
+namespace ityr {
+
+namespace internal {
+
+// Counts the heads of runs (elements whose key is not equivalent to the preceding one) in
+// [b, e) of the key range of length `n`.
+template <typename KeyType, typename KeyEq, typename KeyFn, typename ForwardIteratorK>
+inline std::size_t count_run_heads(const execution::sequenced_policy& policy,
+                                   KeyEq                              key_eq,
+                                   KeyFn                              key_fn,
+                                   ForwardIteratorK                   first_k,
+                                   std::size_t                        b,
+                                   std::size_t                        e) {
+  std::size_t s = b > 0 ? b - 1 : 0;
+  std::size_t j = s;
+  std::size_t c = 0;
+  std::optional<KeyType> prev;
+
+  for_each_aux(
+      policy,
+      [&](const auto& k_ref) {
+        KeyType k = key_fn(k_ref);
+        if (j >= b && (!prev || !key_eq(*prev, k))) c++;
+        prev = std::move(k);
+        j++;
+      },
+      std::next(first_k, s), std::next(first_k, e));
+
+  return c;
+}
+
+// Reduces each run of consecutive equivalent keys whose head is in [b, e) of the ranges of length
+// `n`, and writes the results to the output ranges. A run can extend beyond `e`, in which case
+// the elements are read until the end of the run. Returns the number of runs.
+template <typename KeyType, typename KeyEq, typename KeyFn, typename FoldOp, typename Reducer,
+          typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD>
+inline std::size_t reduce_runs(const execution::sequenced_policy& policy,
+                               KeyEq                              key_eq,
+                               KeyFn                              key_fn,
+                               FoldOp                             fold_op,
+                               Reducer                            reducer,
+                               ForwardIteratorK                   first_k,
+                               ForwardIteratorV                   first_v,
+                               std::size_t                        n,
+                               std::size_t                        b,
+                               std::size_t                        e,
+                               ForwardIteratorKD                  first_kd,
+                               ForwardIteratorVD                  first_vd) {
+  using accumulator_type = typename Reducer::accumulator_type;
+
+  std::vector<KeyType>          keys_buf;
+  std::vector<accumulator_type> accs_buf;
+
+  std::size_t s = b > 0 ? b - 1 : 0;
+  std::size_t j = s;
+  std::optional<KeyType> prev;
+  std::optional<accumulator_type> acc;
+
+  find_aux(
+      policy,
+      [&](auto&& k_ref, auto&& v_ref) {
+        KeyType k = key_fn(k_ref);
+        bool is_head = !prev || !key_eq(*prev, k);
+        if (j >= b) {
+          if (is_head && acc.has_value()) {
+            accs_buf.push_back(std::move(*acc));
+            acc.reset();
+          }
+          if (j >= e && !acc.has_value()) {
+            return true;
+          }
+          if (is_head) {
+            keys_buf.push_back(k);
+            acc.emplace(reducer());
+          }
+          if (acc.has_value()) {
+            fold_op(*acc, k_ref, v_ref);
+          }
+        }
+        prev = std::move(k);
+        j++;
+        return false;
+      },
+      [](std::size_t) { return false; },
+      std::next(first_k, s), std::next(first_k, n), std::next(first_v, s));
+
+  if (acc.has_value()) {
+    accs_buf.push_back(std::move(*acc));
+  }
+
+  std::size_t c = keys_buf.size();
+  ITYR_CHECK(accs_buf.size() == c);
+
+  if (c > 0) {
+    for_each_aux(
+        policy,
+        [](auto&& src_k, auto&& src_v, auto&& dst_k, auto&& dst_v) {
+          dst_k = std::move(src_k);
+          dst_v = std::move(src_v);
+        },
+        keys_buf.begin(), keys_buf.end(), accs_buf.begin(), first_kd, first_vd);
+  }
+
+  return c;
+}
+
+template <typename KeyType, typename KeyEq, typename KeyFn, typename FoldOp, typename Reducer,
+          typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD>
+inline std::size_t reduce_by_key_generic(const execution::sequenced_policy& policy,
+                                         KeyEq                              key_eq,
+                                         KeyFn                              key_fn,
+                                         FoldOp                             fold_op,
+                                         Reducer                            reducer,
+                                         ForwardIteratorK                   first_k,
+                                         ForwardIteratorK                   last_k,
+                                         ForwardIteratorV                   first_v,
+                                         ForwardIteratorKD                  first_kd,
+                                         ForwardIteratorVD                  first_vd) {
+  execution::internal::assert_policy(policy);
+  std::size_t n = std::distance(first_k, last_k);
+  return reduce_runs<KeyType>(policy, key_eq, key_fn, fold_op, reducer,
+                              first_k, first_v, n, 0, n, first_kd, first_vd);
+}
+
+// Each run is reduced by the block that contains its head, so that no partial result of a run
+// spanning multiple blocks has to be combined. As with `copy_if_generic()`, the heads of runs are
+// counted for each block first, and the counts are scanned to determine the output positions.
+template <typename KeyType, typename W, typename KeyEq, typename KeyFn, typename FoldOp,
+          typename Reducer, typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD>
+inline std::size_t reduce_by_key_generic(const execution::parallel_policy<W>& policy,
+                                         KeyEq                                key_eq,
+                                         KeyFn                                key_fn,
+                                         FoldOp                               fold_op,
+                                         Reducer                              reducer,
+                                         ForwardIteratorK                     first_k,
+                                         ForwardIteratorK                     last_k,
+                                         ForwardIteratorV                     first_v,
+                                         ForwardIteratorKD                    first_kd,
+                                         ForwardIteratorVD                    first_vd) {
+  execution::internal::assert_policy(policy);
+
+  std::size_t n = std::distance(first_k, last_k);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(KeyType));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    return reduce_runs<KeyType>(seq_policy, key_eq, key_fn, fold_op, reducer,
+                                first_k, first_v, n, 0, n, first_kd, first_vd);
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<std::size_t> counts = ori::malloc<std::size_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(counts, checkout_mode::write),
+      [=](std::size_t i, std::size_t& count) {
+        count = count_run_heads<KeyType>(seq_policy, key_eq, key_fn, first_k,
+                                         i * b, std::min(n, (i + 1) * b));
+      });
+
+  std::size_t total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(counts    , checkout_mode::read_write),
+      make_global_iterator(counts + m, checkout_mode::read_write),
+      [&](std::size_t& count) {
+        std::size_t c = count;
+        count = total;
+        total += c;
+      });
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(counts, checkout_mode::read),
+      [=](std::size_t i, std::size_t offset) {
+        reduce_runs<KeyType>(seq_policy, key_eq, key_fn, fold_op, reducer,
+                             first_k, first_v, n, i * b, std::min(n, (i + 1) * b),
+                             std::next(first_kd, offset), std::next(first_vd, offset));
+      });
+
+  ori::free(counts, m);
+
+  return total;
+}
+
+template <typename Key, typename Acc>
+struct group_entry {
+  Key key;
+  Acc acc;
+};
+
+template <typename Reducer, typename Map, typename ForwardIteratorK, typename ForwardIteratorV>
+inline void group_into_map(const execution::sequenced_policy& policy,
+                           Reducer                            reducer,
+                           Map&                               map,
+                           ForwardIteratorK                   first_k,
+                           ForwardIteratorK                   last_k,
+                           ForwardIteratorV                   first_v) {
+  for_each_aux(
+      policy,
+      [&](const auto& k, const auto& v) {
+        auto it = map.find(k);
+        if (it == map.end()) {
+          it = map.emplace(k, reducer()).first;
+        }
+        reducer(it->second, v);
+      },
+      first_k, last_k, first_v);
+}
+
+template <typename Reducer, typename KeyCompare, typename ForwardIteratorK,
+          typename ForwardIteratorV, typename ForwardIteratorKD, typename ForwardIteratorVD>
+inline std::size_t group_reduce_generic(const execution::sequenced_policy& policy,
+                                        Reducer                            reducer,
+                                        KeyCompare                         key_comp,
+                                        ForwardIteratorK                   first_k,
+                                        ForwardIteratorK                   last_k,
+                                        ForwardIteratorV                   first_v,
+                                        ForwardIteratorKD                  first_kd,
+                                        ForwardIteratorVD                  first_vd) {
+  using key_type         = typename std::iterator_traits<ForwardIteratorK>::value_type;
+  using accumulator_type = typename Reducer::accumulator_type;
+  using entry_t          = group_entry<key_type, accumulator_type>;
+
+  execution::internal::assert_policy(policy);
+
+  group_map<key_type, accumulator_type> map;
+  group_into_map(policy, reducer, map, first_k, last_k, first_v);
+
+  std::vector<entry_t> entries;
+  entries.reserve(map.size());
+  for (auto&& [k, acc] : map) {
+    entries.push_back(entry_t{k, std::move(acc)});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [=](const entry_t& e1, const entry_t& e2) { return key_comp(e1.key, e2.key); });
+
+  if (!entries.empty()) {
+    for_each_aux(
+        policy,
+        [](entry_t& e, auto&& dst_k, auto&& dst_v) {
+          dst_k = std::move(e.key);
+          dst_v = std::move(e.acc);
+        },
+        entries.begin(), entries.end(), first_kd, first_vd);
+  }
+
+  return entries.size();
+}
+
+// Each block of the input is grouped into a local hash table, and the entries are staged in
+// global memory as in `copy_if_in_place()`. The staged entries are then sorted by key so that
+// the partial results for the same key are gathered, and they are combined by
+// `reduce_by_key_generic()`.
+template <typename W, typename Reducer, typename KeyCompare, typename ForwardIteratorK,
+          typename ForwardIteratorV, typename ForwardIteratorKD, typename ForwardIteratorVD>
+inline std::size_t group_reduce_generic(const execution::parallel_policy<W>& policy,
+                                        Reducer                              reducer,
+                                        KeyCompare                           key_comp,
+                                        ForwardIteratorK                     first_k,
+                                        ForwardIteratorK                     last_k,
+                                        ForwardIteratorV                     first_v,
+                                        ForwardIteratorKD                    first_kd,
+                                        ForwardIteratorVD                    first_vd) {
+  using key_type         = typename std::iterator_traits<ForwardIteratorK>::value_type;
+  using accumulator_type = typename Reducer::accumulator_type;
+  using entry_t          = group_entry<key_type, accumulator_type>;
+  using stage_t          = copy_if_stage<entry_t>;
+
+  execution::internal::assert_policy(policy);
+
+  std::size_t n = std::distance(first_k, last_k);
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(key_type));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy = execution::internal::to_sequenced_policy(policy);
+
+  if (m <= 1) {
+    return group_reduce_generic(seq_policy, reducer, key_comp, first_k, last_k, first_v,
+                                first_kd, first_vd);
+  }
+
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<stage_t> stages = ori::malloc<stage_t>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(stages, checkout_mode::write),
+      [=](std::size_t i, stage_t& stage) {
+        std::size_t d = std::min(n - i * b, b);
+        auto first_k_ = std::next(first_k, i * b);
+
+        group_map<key_type, accumulator_type> map;
+        group_into_map(seq_policy, reducer, map, first_k_, std::next(first_k_, d),
+                       std::next(first_v, i * b));
+
+        std::size_t c = map.size();
+        ori::global_ptr<entry_t> p = c > 0 ? ori::malloc<entry_t>(c) : nullptr;
+        if (c > 0) {
+          for_each(
+              seq_policy,
+              map.begin(),
+              map.end(),
+              make_construct_iterator(p),
+              [](auto&& kv, entry_t* dst) { new (dst) entry_t{kv.first, std::move(kv.second)}; });
+        }
+        stage = stage_t{p, c, 0};
+      });
+
+  std::size_t total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(stages    , checkout_mode::read_write),
+      make_global_iterator(stages + m, checkout_mode::read_write),
+      [&](stage_t& stage) {
+        stage.offset = total;
+        total += stage.count;
+      });
+
+  if (total == 0) {
+    ori::free(stages, m);
+    return 0;
+  }
+
+  ori::global_ptr<entry_t> entries = ori::malloc<entry_t>(total);
+
+  for_each(
+      block_policy,
+      make_global_iterator(stages    , checkout_mode::read),
+      make_global_iterator(stages + m, checkout_mode::read),
+      [=](const stage_t& stage) {
+        if (stage.count > 0) {
+          for_each(
+              seq_policy,
+              make_destruct_iterator(stage.buf),
+              make_destruct_iterator(stage.buf + stage.count),
+              make_construct_iterator(entries + stage.offset),
+              [](entry_t* src, entry_t* dst) {
+                new (dst) entry_t(std::move(*src));
+                std::destroy_at(src);
+              });
+          ori::free(stage.buf, stage.count);
+        }
+      });
+
+  ori::free(stages, m);
+
+  sort(policy, entries, entries + total,
+       [=](const entry_t& e1, const entry_t& e2) { return key_comp(e1.key, e2.key); });
+
+  using src_mode = src_checkout_mode_t<entry_t>;
+
+  std::size_t c = reduce_by_key_generic<key_type>(
+      policy,
+      [=](const key_type& k1, const key_type& k2) { return !key_comp(k1, k2) && !key_comp(k2, k1); },
+      [](const entry_t& e) { return e.key; },
+      [=](accumulator_type& acc, auto&&, auto&& e) { reducer(acc, std::move(e.acc)); },
+      reducer,
+      make_global_iterator(entries        , src_mode{}),
+      make_global_iterator(entries + total, src_mode{}),
+      make_global_iterator(entries        , src_mode{}),
+      first_kd, first_vd);
+
+  for_each(
+      policy,
+      make_destruct_iterator(entries),
+      make_destruct_iterator(entries + total),
+      [](entry_t* p) { std::destroy_at(p); });
+
+  ori::free(entries, total);
+
+  return c;
+}
+
+}
+
+/**
+ * @brief Reduce each run of consecutive equivalent keys.
+ *
+ * @param policy      Execution policy (`ityr::execution`).
+ * @param first_k     Begin iterator of the keys.
+ * @param last_k      End iterator of the keys.
+ * @param first_v     Begin iterator of the values.
+ * @param first_kd    Begin iterator of the output keys.
+ * @param first_vd    Begin iterator of the output values.
+ * @param reducer     Reducer object (`ityr::reducer`).
+ * @param binary_pred Binary predicate operator to determine the equivalence of two keys.
+ *
+ * @return A pair of the end iterators of the output keys and values.
+ *
+ * For each run of consecutive equivalent keys in `[first_k, last_k)` (typically sorted), the
+ * corresponding values are reduced into an accumulator (of `Reducer::accumulator_type`), which
+ * starts with the identity `reducer()` and is folded by `reducer(acc, value)` from left to right.
+ * The first key of each run and the reduced result are written to the output ranges.
+ *
+ * If given iterators are global pointers, they are automatically checked out in the specified
+ * granularity (`ityr::execution::sequenced_policy::checkout_count`) without explicitly passing them
+ * as global iterators.
+ *
+ * In parallel execution, the input is divided into blocks, and each run is reduced by the task
+ * for the block containing its first element. Thus, a run much longer than `cutoff_count` is
+ * reduced serially.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> keys = {1, 1, 2, 3, 3, 3};
+ * ityr::global_vector<int> vals = {1, 2, 3, 4, 5, 6};
+ * ityr::global_vector<int> out_keys(keys.size());
+ * ityr::global_vector<int> out_vals(keys.size());
+ * auto [it_k, it_v] = ityr::reduce_by_key(ityr::execution::par, keys.begin(), keys.end(),
+ *                                         vals.begin(), out_keys.begin(), out_vals.begin(),
+ *                                         ityr::reducer::plus<int>{},
+ *                                         [](int x, int y) { return x == y; });
+ * // out_keys = {1, 2, 3, 0, 0, 0}
+ * // out_vals = {3, 3, 15, 0, 0, 0}
+ * //                     ^
+ * //                     it_k, it_v
+ * ```
+ *
+ * @see `ityr::group_reduce()`
+ * @see `ityr::reduce()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD, typename Reducer,
+          typename BinaryPredicate>
+inline std::pair<ForwardIteratorKD, ForwardIteratorVD>
+reduce_by_key(const ExecutionPolicy& policy,
+              ForwardIteratorK       first_k,
+              ForwardIteratorK       last_k,
+              ForwardIteratorV       first_v,
+              ForwardIteratorKD      first_kd,
+              ForwardIteratorVD      first_vd,
+              Reducer                reducer,
+              BinaryPredicate        binary_pred) {
+  using key_type     = typename std::iterator_traits<ForwardIteratorK>::value_type;
+  using value_type   = typename std::iterator_traits<ForwardIteratorV>::value_type;
+  using key_type_d   = typename std::iterator_traits<ForwardIteratorKD>::value_type;
+  using value_type_d = typename std::iterator_traits<ForwardIteratorVD>::value_type;
+
+  std::size_t c = internal::reduce_by_key_generic<key_type>(
+      policy,
+      binary_pred,
+      [](const auto& k) { return k; },
+      [=](auto& acc, const auto&, const auto& v) { reducer(acc, v); },
+      reducer,
+      internal::convert_to_global_iterator(first_k , checkout_mode::read),
+      internal::convert_to_global_iterator(last_k  , checkout_mode::read),
+      internal::convert_to_global_iterator(first_v , internal::src_checkout_mode_t<value_type>{}),
+      internal::convert_to_global_iterator(first_kd, internal::dest_checkout_mode_t<key_type_d>{}),
+      internal::convert_to_global_iterator(first_vd, internal::dest_checkout_mode_t<value_type_d>{}));
+
+  return std::make_pair(std::next(first_kd, c), std::next(first_vd, c));
+}
+
+/**
+ * @brief Reduce each run of consecutive equal keys.
+ *
+ * @param policy   Execution policy (`ityr::execution`).
+ * @param first_k  Begin iterator of the keys.
+ * @param last_k   End iterator of the keys.
+ * @param first_v  Begin iterator of the values.
+ * @param first_kd Begin iterator of the output keys.
+ * @param first_vd Begin iterator of the output values.
+ * @param reducer  Reducer object (`ityr::reducer`).
+ *
+ * @return A pair of the end iterators of the output keys and values.
+ *
+ * Equivalent to `ityr::reduce_by_key(policy, first_k, last_k, first_v, first_kd, first_vd, reducer, std::equal_to<>{})`.
+ *
+ * @see `ityr::group_reduce()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD, typename Reducer>
+inline std::pair<ForwardIteratorKD, ForwardIteratorVD>
+reduce_by_key(const ExecutionPolicy& policy,
+              ForwardIteratorK       first_k,
+              ForwardIteratorK       last_k,
+              ForwardIteratorV       first_v,
+              ForwardIteratorKD      first_kd,
+              ForwardIteratorVD      first_vd,
+              Reducer                reducer) {
+  return reduce_by_key(policy, first_k, last_k, first_v, first_kd, first_vd, reducer,
+                       std::equal_to<>{});
+}
+
+/**
+ * @brief Reduce the values for each distinct key in an unsorted range.
+ *
+ * @param policy   Execution policy (`ityr::execution`).
+ * @param first_k  Begin iterator of the keys.
+ * @param last_k   End iterator of the keys.
+ * @param first_v  Begin iterator of the values.
+ * @param first_kd Begin iterator of the output keys.
+ * @param first_vd Begin iterator of the output values.
+ * @param reducer  Reducer object (`ityr::reducer`).
+ * @param key_comp Comparison operator for keys.
+ *
+ * @return A pair of the end iterators of the output keys and values.
+ *
+ * The values for each distinct key in `[first_k, last_k)` are reduced into an accumulator (of
+ * `Reducer::accumulator_type`), and the distinct keys (in ascending order of `key_comp`) and the
+ * reduced results are written to the output ranges. The output ranges should be large enough for
+ * the number of distinct keys. Keys must be hashable and equality comparable.
+ *
+ * Each leaf task groups its values into a local hash table, and the partial results of all tasks
+ * are then sorted by key (`ityr::sort()`) and combined by `reducer(acc1, acc2)`, as in
+ * `ityr::reduce_by_key()`. Thus, no hash table needs to be transferred between processes, and
+ * the amount of temporary global memory is proportional to the number of distinct keys in each
+ * leaf task. Unlike `ityr::reduce()`, the order of values in the reduction is unspecified, so the
+ * reducer should be commutative.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> keys = {3, 1, 3, 2, 1, 3};
+ * ityr::global_vector<int> vals = {1, 2, 3, 4, 5, 6};
+ * ityr::global_vector<int> out_keys(keys.size());
+ * ityr::global_vector<int> out_vals(keys.size());
+ * auto [it_k, it_v] = ityr::group_reduce(ityr::execution::par, keys.begin(), keys.end(),
+ *                                        vals.begin(), out_keys.begin(), out_vals.begin(),
+ *                                        ityr::reducer::plus<int>{}, std::less<>{});
+ * // out_keys = {1, 2, 3, 0, 0, 0}
+ * // out_vals = {7, 4, 10, 0, 0, 0}
+ * //                     ^
+ * //                     it_k, it_v
+ * ```
+ *
+ * @see `ityr::reduce_by_key()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD, typename Reducer,
+          typename KeyCompare>
+inline std::pair<ForwardIteratorKD, ForwardIteratorVD>
+group_reduce(const ExecutionPolicy& policy,
+             ForwardIteratorK       first_k,
+             ForwardIteratorK       last_k,
+             ForwardIteratorV       first_v,
+             ForwardIteratorKD      first_kd,
+             ForwardIteratorVD      first_vd,
+             Reducer                reducer,
+             KeyCompare             key_comp) {
+  using value_type   = typename std::iterator_traits<ForwardIteratorV>::value_type;
+  using key_type_d   = typename std::iterator_traits<ForwardIteratorKD>::value_type;
+  using value_type_d = typename std::iterator_traits<ForwardIteratorVD>::value_type;
+
+  std::size_t c = internal::group_reduce_generic(
+      policy,
+      reducer,
+      key_comp,
+      internal::convert_to_global_iterator(first_k , checkout_mode::read),
+      internal::convert_to_global_iterator(last_k  , checkout_mode::read),
+      internal::convert_to_global_iterator(first_v , internal::src_checkout_mode_t<value_type>{}),
+      internal::convert_to_global_iterator(first_kd, internal::dest_checkout_mode_t<key_type_d>{}),
+      internal::convert_to_global_iterator(first_vd, internal::dest_checkout_mode_t<value_type_d>{}));
+
+  return std::make_pair(std::next(first_kd, c), std::next(first_vd, c));
+}
+
+/**
+ * @brief Reduce the values for each distinct key in an unsorted range.
+ *
+ * Equivalent to `ityr::group_reduce(policy, first_k, last_k, first_v, first_kd, first_vd, reducer, std::less<>{})`.
+ *
+ * @see `ityr::reduce_by_key()`
+ */
+template <typename ExecutionPolicy, typename ForwardIteratorK, typename ForwardIteratorV,
+          typename ForwardIteratorKD, typename ForwardIteratorVD, typename Reducer>
+inline std::pair<ForwardIteratorKD, ForwardIteratorVD>
+group_reduce(const ExecutionPolicy& policy,
+             ForwardIteratorK       first_k,
+             ForwardIteratorK       last_k,
+             ForwardIteratorV       first_v,
+             ForwardIteratorKD      first_kd,
+             ForwardIteratorVD      first_vd,
+             Reducer                reducer) {
+  return group_reduce(policy, first_k, last_k, first_v, first_kd, first_vd, reducer,
+                      std::less<>{});
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_reduce_by_key] reduce_by_key") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+
+  ITYR_SUBCASE("runs of various lengths") {
+    root_exec([=] {
+      // key i / 1 for i < 1000, i / 10 for i < 10000, and a long run of i / 30000 afterwards
+      auto key_of = [](long i) {
+        return i < 1000 ? i : i < 10000 ? 1000 + i / 10 : 2000 + i / 30000;
+      };
+
+      global_vector<long> keys(n);
+      transform(execution::par, count_iterator<long>(0), count_iterator<long>(n), keys.begin(), key_of);
+
+      global_vector<long> out_keys(n);
+      global_vector<long> out_vals(n);
+
+      auto [it_k, it_v] = reduce_by_key(
+          execution::parallel_policy(128),
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys.begin(), out_vals.begin(), reducer::plus<long>{});
+
+      std::size_t n_runs = 1000 + 900 + 4;
+      ITYR_CHECK(std::size_t(it_k - out_keys.begin()) == n_runs);
+      ITYR_CHECK(std::size_t(it_v - out_vals.begin()) == n_runs);
+
+      auto sum = reduce(execution::par, out_vals.begin(), it_v);
+      ITYR_CHECK(sum == n * (n - 1) / 2);
+
+      for_each(
+          execution::par,
+          make_global_iterator(out_keys.begin(), checkout_mode::read),
+          make_global_iterator(it_k            , checkout_mode::read),
+          make_global_iterator(out_vals.begin(), checkout_mode::read),
+          [=](long k, long v) {
+            // the run of key `k` is [b, e)
+            long b = k < 1000 ? k : k < 2000 ? (k - 1000) * 10 : std::max(10000L, (k - 2000) * 30000);
+            long e = k < 1000 ? k + 1 : k < 2000 ? b + 10 : std::min(n, (k - 1999) * 30000);
+            ITYR_CHECK(v == (b + e - 1) * (e - b) / 2);
+          });
+
+      // the sequential execution gives the same result
+      global_vector<long> out_vals_seq(n);
+      auto [it_k2, it_v2] = reduce_by_key(
+          execution::seq,
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys.begin(), out_vals_seq.begin(), reducer::plus<long>{});
+      ITYR_CHECK(it_v2 - out_vals_seq.begin() == it_v - out_vals.begin());
+      ITYR_CHECK(it_k2 == it_k);
+      ITYR_CHECK(equal(execution::par, out_vals.begin(), it_v, out_vals_seq.begin()));
+    });
+  }
+
+  ITYR_SUBCASE("custom predicate and empty input") {
+    root_exec([=] {
+      global_vector<int> keys(n);
+      transform(execution::par, count_iterator<long>(0), count_iterator<long>(n), keys.begin(),
+                [](long i) { return int(i / 3); });
+
+      global_vector<int> out_keys(n);
+      global_vector<long> out_vals(n);
+
+      // keys are equivalent if they are in the same group of 10
+      auto [it_k, it_v] = reduce_by_key(
+          execution::parallel_policy(100),
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys.begin(), out_vals.begin(), reducer::max<long>{},
+          [](int k1, int k2) { return k1 / 10 == k2 / 10; });
+
+      std::size_t n_runs = (n / 3 + 10) / 10;
+      ITYR_CHECK(std::size_t(it_k - out_keys.begin()) == n_runs);
+
+      for_each(
+          execution::par,
+          count_iterator<std::size_t>(0), count_iterator<std::size_t>(n_runs),
+          make_global_iterator(out_keys.begin(), checkout_mode::read),
+          make_global_iterator(out_vals.begin(), checkout_mode::read),
+          [=](std::size_t r, int k, long v) {
+            ITYR_CHECK(k == int(r * 10));
+            ITYR_CHECK(v == std::min(n - 1, long(r * 30 + 29)));
+          });
+
+      auto [it_k2, it_v2] = reduce_by_key(
+          execution::par,
+          keys.begin(), keys.begin(), count_iterator<long>(0),
+          out_keys.begin(), out_vals.begin(), reducer::plus<long>{});
+      ITYR_CHECK(it_k2 == out_keys.begin());
+      ITYR_CHECK(it_v2 == out_vals.begin());
+    });
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_reduce_by_key] group_reduce") {
+  ito::init();
+  ori::init();
+
+  long n = 40000;
+
+  ITYR_SUBCASE("few keys") {
+    root_exec([=] {
+      long n_keys = 7;
+      global_vector<long> keys(n);
+      transform(execution::par, count_iterator<long>(0), count_iterator<long>(n), keys.begin(),
+                [=](long i) { return (i * 5) % n_keys; });
+
+      global_vector<long> out_keys(n);
+      global_vector<long> out_vals(n);
+
+      auto [it_k, it_v] = group_reduce(
+          execution::parallel_policy(128),
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys.begin(), out_vals.begin(), reducer::plus<long>{});
+      ITYR_CHECK(it_k - out_keys.begin() == n_keys);
+      ITYR_CHECK(it_v - out_vals.begin() == n_keys);
+
+      for_each(
+          execution::seq,
+          count_iterator<long>(0), count_iterator<long>(n_keys),
+          make_global_iterator(out_keys.begin(), checkout_mode::read),
+          make_global_iterator(out_vals.begin(), checkout_mode::read),
+          [=](long r, long k, long v) {
+            ITYR_CHECK(k == r);
+            long s = 0;
+            for (long i = 0; i < n; i++) {
+              if ((i * 5) % n_keys == k) s += i;
+            }
+            ITYR_CHECK(v == s);
+          });
+    });
+  }
+
+  ITYR_SUBCASE("many keys in descending order") {
+    root_exec([=] {
+      long n_keys = n / 4;
+      global_vector<long> keys(n);
+      transform(execution::par, count_iterator<long>(0), count_iterator<long>(n), keys.begin(),
+                [=](long i) { return (i * 7919) % n_keys; });
+
+      global_vector<long> out_keys(n);
+      global_vector<std::size_t> out_vals(n);
+
+      // counts the values for each key
+      auto count_reducer = reducer::make_reducer(
+          [](std::size_t& acc, long) { acc++; },
+          [](std::size_t& acc_l, const std::size_t& acc_r) { acc_l += acc_r; },
+          []() { return std::size_t(0); });
+
+      auto [it_k, it_v] = group_reduce(
+          execution::parallel_policy(128),
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys.begin(), out_vals.begin(),
+          count_reducer, std::greater<>{});
+      ITYR_CHECK(it_k - out_keys.begin() == n_keys);
+
+      for_each(
+          execution::par,
+          count_iterator<long>(0), count_iterator<long>(n_keys),
+          make_global_iterator(out_keys.begin(), checkout_mode::read),
+          make_global_iterator(out_vals.begin(), checkout_mode::read),
+          [=](long r, long k, std::size_t count) {
+            ITYR_CHECK(k == n_keys - 1 - r);
+            ITYR_CHECK(count == 4);
+          });
+
+      // the sequential execution gives the same result
+      global_vector<long> out_keys_seq(n);
+      global_vector<std::size_t> out_vals_seq(n);
+      auto [it_k2, it_v2] = group_reduce(
+          execution::seq,
+          keys.begin(), keys.end(), count_iterator<long>(0),
+          out_keys_seq.begin(), out_vals_seq.begin(),
+          count_reducer, std::greater<>{});
+      ITYR_CHECK(it_k2 - out_keys_seq.begin() == n_keys);
+      ITYR_CHECK(equal(execution::par, out_keys.begin(), it_k, out_keys_seq.begin()));
+      ITYR_CHECK(equal(execution::par, out_vals.begin(), it_v, out_vals_seq.begin()));
+    });
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
+}
@@ -392,6 +392,151 @@ minmax_element(const ExecutionPolicy& policy,
   return minmax_element(policy, first, last, std::less<>{});
 }
 
+/**
+ * @brief Search for the first element satisfying a predicate in a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param pred   Unary predicate operator.
+ *
+ * @return Iterator to the first element in the range `[first, last)` for which `pred` returns true,
+ *         or `last` if no such element is found.
+ *
+ * Once an element is found, the remaining tasks for the later elements are cooperatively cancelled
+ * (`ito::cancel()`), so the amount of work is roughly proportional to the position of the found
+ * element rather than the length of the range.
+ *
+ * If global pointers are provided as iterators, they are automatically checked out with the read-only
+ * mode in the specified granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
+ * or `ityr::execution::parallel_policy::checkout_count` if parallel) without explicitly passing them
+ * as global iterators.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {1, 3, 4, 5, 6};
+ * auto it = ityr::find_if(ityr::execution::par, v.begin(), v.end(),
+ *                         [](int x) { return x % 2 == 0; });
+ * // it = v.begin() + 2, *it = 4
+ * ```
+ *
+ * @see [std::find_if -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/find)
+ * @see `ityr::find()`
+ * @see `ityr::any_of()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+inline ForwardIterator find_if(const ExecutionPolicy& policy,
+                               ForwardIterator        first,
+                               ForwardIterator        last,
+                               UnaryPredicate         pred) {
+  if constexpr (ori::is_global_ptr_v<ForwardIterator>) {
+    return std::next(first, internal::find_generic(
+        policy,
+        pred,
+        internal::convert_to_global_iterator(first, checkout_mode::read),
+        internal::convert_to_global_iterator(last , checkout_mode::read)));
+
+  } else {
+    return std::next(first, internal::find_generic(policy, pred, first, last));
+  }
+}
+
+/**
+ * @brief Search for the first element equal to the given value in a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param value  Value to be searched for.
+ *
+ * @return Iterator to the first element in the range `[first, last)` that is equal to `value`,
+ *         or `last` if no such element is found.
+ *
+ * Equivalent to `ityr::find_if(policy, first, last, [&](const auto& x) { return x == value; })`.
+ *
+ * @see [std::find -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/find)
+ * @see `ityr::find_if()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+inline ForwardIterator find(const ExecutionPolicy& policy,
+                            ForwardIterator        first,
+                            ForwardIterator        last,
+                            const T&               value) {
+  return find_if(policy, first, last, [=](const auto& x) { return x == value; });
+}
+
+/**
+ * @brief Check if any element in a range satisfies a predicate.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param pred   Unary predicate operator.
+ *
+ * @return True if `pred` returns true for at least one element in the range `[first, last)`.
+ *
+ * The search is stopped early once such an element is found (see `ityr::find_if()`).
+ *
+ * @see [std::any_of -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/all_any_none_of)
+ * @see `ityr::all_of()`
+ * @see `ityr::none_of()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+inline bool any_of(const ExecutionPolicy& policy,
+                   ForwardIterator        first,
+                   ForwardIterator        last,
+                   UnaryPredicate         pred) {
+  return find_if(policy, first, last, pred) != last;
+}
+
+/**
+ * @brief Check if all elements in a range satisfy a predicate.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param pred   Unary predicate operator.
+ *
+ * @return True if `pred` returns true for all elements in the range `[first, last)`.
+ *
+ * The search is stopped early once an element not satisfying `pred` is found.
+ *
+ * @see [std::all_of -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/all_any_none_of)
+ * @see `ityr::any_of()`
+ * @see `ityr::none_of()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+inline bool all_of(const ExecutionPolicy& policy,
+                   ForwardIterator        first,
+                   ForwardIterator        last,
+                   UnaryPredicate         pred) {
+  return find_if(policy, first, last, [=](const auto& x) { return !pred(x); }) == last;
+}
+
+/**
+ * @brief Check if no element in a range satisfies a predicate.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param pred   Unary predicate operator.
+ *
+ * @return True if `pred` returns false for all elements in the range `[first, last)`.
+ *
+ * @see [std::none_of -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/all_any_none_of)
+ * @see `ityr::any_of()`
+ * @see `ityr::all_of()`
+ */
+template <typename ExecutionPolicy, typename ForwardIterator, typename UnaryPredicate>
+inline bool none_of(const ExecutionPolicy& policy,
+                    ForwardIterator        first,
+                    ForwardIterator        last,
+                    UnaryPredicate         pred) {
+  return !any_of(policy, first, last, pred);
+}
+
 ITYR_TEST_CASE("[ityr::pattern::parallel_search] min, max, minmax_element") {
   ito::init();
   ori::init();
@@ -438,4 +583,56 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_search] min, max, minmax_element") {
   ito::fini();
 }
 
+ITYR_TEST_CASE("[ityr::pattern::parallel_search] find, find_if, any_of, all_of, none_of") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    transform(
+        execution::parallel_policy(100),
+        count_iterator<long>(0), count_iterator<long>(n), p,
+        [=](long i) { return i % 7; });
+
+    long pos = n / 3;
+    long pos_dummy = n / 3 * 2;
+    p[pos].put(-1);
+    p[pos_dummy].put(-1);
+
+    ITYR_CHECK(find(execution::parallel_policy(100), p, p + n, -1) == p + pos);
+    ITYR_CHECK(find(execution::sequenced_policy(100), p, p + n, -1) == p + pos);
+    ITYR_CHECK(find(execution::parallel_policy(100), p, p + n, -2) == p + n);
+    ITYR_CHECK(find(execution::parallel_policy(100), p + pos + 1, p + n, -1) == p + pos_dummy);
+
+    // Predicates are defined outside ITYR_CHECK(), as lambdas cannot appear in its unevaluated
+    // operand when checks are disabled (NDEBUG)
+    auto is_negative = [](long x) { return x < 0; };
+    auto lt7         = [](long x) { return x < 7; };
+    auto gt7         = [](long x) { return x > 7; };
+    auto nonnegative = [](long x) { return x >= 0; };
+    auto square_gt   = [](long i) { return i * i > 1000; };
+
+    ITYR_CHECK(find_if(execution::parallel_policy(100), p, p + n, is_negative) == p + pos);
+    ITYR_CHECK(find_if(execution::parallel_policy(100), p, p + n, gt7) == p + n);
+    ITYR_CHECK(find_if(execution::parallel_policy(100), p, p, is_negative) == p);
+
+    ITYR_CHECK(any_of(execution::parallel_policy(100), p, p + n, is_negative));
+    ITYR_CHECK(!any_of(execution::parallel_policy(100), p, p + n, gt7));
+    ITYR_CHECK(all_of(execution::parallel_policy(100), p, p + n, lt7));
+    ITYR_CHECK(!all_of(execution::parallel_policy(100), p, p + n, nonnegative));
+    ITYR_CHECK(none_of(execution::parallel_policy(100), p, p + n, gt7));
+
+    ITYR_CHECK(find_if(execution::parallel_policy(100),
+                       count_iterator<long>(0), count_iterator<long>(n),
+                       square_gt) == count_iterator<long>(32));
+  });
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
 }
@@ -0,0 +1,852 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cmath>
+
+#include "ityr/common/util.hpp"
+#include "ityr/pattern/count_iterator.hpp"
+#include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_reduce.hpp"
+#include "ityr/pattern/parallel_filter.hpp"
+#include "ityr/pattern/parallel_sort.hpp"
+#include "ityr/pattern/parallel_search.hpp"
+#include "ityr/pattern/reducer_extra.hpp"
+#include "ityr/container/global_vector.hpp"
+#include "ityr/container/checkout_span.hpp"
+
+namespace ityr {
+
+namespace internal {
+
+// Expected number of samples drawn from the candidate window in each round of selection
+inline constexpr std::size_t select_sample_size = 4096;
+
+template <typename T>
+struct select_item {
+  T           value;
+  std::size_t index;
+};
+
+// Elements are ordered by (value, position) so that all elements are distinct and the k-th
+// element splits the range into exactly k smaller elements and the rest
+template <typename Compare>
+struct select_order {
+  Compare comp;
+
+  template <typename T>
+  bool operator()(const T& x, std::size_t i, const select_item<T>& y) const {
+    return comp(x, y.value) || (!comp(y.value, x) && i < y.index);
+  }
+
+  template <typename T>
+  bool operator()(const select_item<T>& x, const select_item<T>& y) const {
+    return (*this)(x.value, x.index, y);
+  }
+};
+
+// The candidates for the k-th element are those strictly between `lo` and `hi`
+template <typename T>
+struct select_window {
+  bool           has_lo = false;
+  bool           has_hi = false;
+  select_item<T> lo     = {};
+  select_item<T> hi     = {};
+
+  template <typename Compare>
+  bool contains(const select_order<Compare>& lt, const T& x, std::size_t i) const {
+    return (!has_lo || lt(lo.value, lo.index, select_item<T>{x, i})) &&
+           (!has_hi || lt(x, i, hi));
+  }
+};
+
+struct select_count_plus {
+  constexpr std::array<std::size_t, 2> operator()(const std::array<std::size_t, 2>& x,
+                                                  const std::array<std::size_t, 2>& y) const {
+    return {x[0] + y[0], x[1] + y[1]};
+  }
+};
+
+using select_count_reducer = reducer::monoid<std::array<std::size_t, 2>, select_count_plus>;
+
+// Returns the k-th element (0-indexed) of `[first, last)` in the (value, position) order without
+// modifying the range. In each round, a random sample is drawn from the current window of
+// candidates, two pivots that bracket the expected rank of the k-th element are chosen from the
+// sample, and the window is narrowed by counting the candidates smaller than the pivots.
+// Each round reads the range twice, and the window shrinks by a factor of about
+// sqrt(select_sample_size) / 4 per round with high probability. Once the window is small enough,
+// all of the candidates are gathered and the k-th element is selected locally.
+template <typename ExecutionPolicy, typename ForwardIterator, typename Compare>
+inline auto select_kth(const ExecutionPolicy& policy,
+                       ForwardIterator        first,
+                       ForwardIterator        last,
+                       std::size_t            k,
+                       Compare                comp) {
+  using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+  using item_t     = select_item<value_type>;
+
+  std::size_t n = std::distance(first, last);
+  ITYR_CHECK(k < n);
+
+  select_order<Compare>     lt {comp};
+  select_window<value_type> window;
+  std::size_t               w = n;
+
+  for (uint64_t round = 0;; round++) {
+    bool     gather_all = w <= 2 * select_sample_size;
+    uint64_t threshold  = std::numeric_limits<uint64_t>::max() / w * select_sample_size;
+    uint64_t seed       = sample_sort_hash(round);
+
+    global_vector<item_t> samples_g = transform_reduce_chunk(
+        policy,
+        first, last, count_iterator<std::size_t>(0),
+        reducer::vec_concat<item_t>{},
+        [=](auto first_, auto last_, auto idx_) {
+          std::vector<item_t> s;
+          for (; first_ != last_; ++first_, ++idx_) {
+            std::size_t i = *idx_;
+            if (window.contains(lt, *first_, i) &&
+                (gather_all || sample_sort_hash(i ^ seed) < threshold)) {
+              s.push_back(item_t{*first_, i});
+            }
+          }
+          return global_vector<item_t>(s.begin(), s.end());
+        });
+
+    std::vector<item_t> samples(samples_g.size());
+    if (!samples.empty()) {
+      auto cs = make_checkout(samples_g.data(), samples_g.size(), checkout_mode::read);
+      std::copy(cs.begin(), cs.end(), samples.begin());
+    }
+
+    if (gather_all) {
+      ITYR_CHECK(samples.size() == w);
+      std::nth_element(samples.begin(), samples.begin() + k, samples.end(), lt);
+      return samples[k];
+    }
+
+    std::size_t m = samples.size();
+    if (m == 0) continue;
+
+    std::sort(samples.begin(), samples.end(), lt);
+
+    std::size_t r      = std::size_t(double(k) / w * m);
+    std::size_t margin = std::size_t(2 * std::sqrt(double(m))) + 1;
+    item_t a = samples[r > margin ? r - margin : 0];
+    item_t b = samples[std::min(m - 1, r + margin)];
+
+    auto [c_a, c_b] = transform_reduce_chunk(
+        policy,
+        first, last, count_iterator<std::size_t>(0),
+        select_count_reducer{},
+        [=](auto first_, auto last_, auto idx_) {
+          std::array<std::size_t, 2> c = {0, 0};
+          for (; first_ != last_; ++first_, ++idx_) {
+            std::size_t i = *idx_;
+            if (window.contains(lt, *first_, i)) {
+              c[0] += lt(*first_, i, a);
+              c[1] += lt(*first_, i, b);
+            }
+          }
+          return c;
+        });
+
+    if (k < c_a) {
+      window.has_hi = true;
+      window.hi     = a;
+      w = c_a;
+    } else if (k == c_a) {
+      return a;
+    } else if (k < c_b) {
+      window.has_lo = true;
+      window.lo     = a;
+      window.has_hi = true;
+      window.hi     = b;
+      k -= c_a + 1;
+      w = c_b - c_a - 1;
+    } else if (k == c_b) {
+      return b;
+    } else {
+      window.has_lo = true;
+      window.lo     = b;
+      k -= c_b + 1;
+      w -= c_b + 1;
+    }
+  }
+}
+
+inline execution::sequenced_policy select_block_policy(const execution::sequenced_policy& policy) {
+  return policy;
+}
+
+template <typename W>
+inline auto select_block_policy(const execution::parallel_policy<W>& policy) {
+  execution::parallel_policy block_policy(1);
+  block_policy.fork_policy = policy.fork_policy;
+  block_policy.lazy_split  = policy.lazy_split;
+  return block_policy;
+}
+
+inline std::size_t select_block_size(const execution::sequenced_policy& policy, std::size_t elem_size) {
+  return std::max(policy.checkout_count, ori::block_size / elem_size);
+}
+
+template <typename W>
+inline std::size_t select_block_size(const execution::parallel_policy<W>& policy, std::size_t elem_size) {
+  return std::max(policy.cutoff_count, ori::block_size / elem_size);
+}
+
+struct partition_at_block {
+  std::size_t l_count;
+  std::size_t r_count;
+  std::size_t l_offset;
+  std::size_t r_offset;
+};
+
+// Rearranges `[first, last)` so that the elements `x` at positions `i` with `pred(x, i) == true`
+// come first, where the number of such elements must be exactly `s`. Only the misplaced elements
+// (those before `s` with `pred == false` and those after `s` with `pred == true`) are moved:
+// the i-th misplaced element after `s` is exchanged with the i-th one before `s` through a
+// temporary buffer, whose size is the number of misplaced elements on each side.
+// `pred` is evaluated only on elements that have not been moved yet, so positions are the original.
+template <typename ExecutionPolicy, typename T, typename Predicate>
+inline void partition_at(const ExecutionPolicy& policy,
+                         ori::global_ptr<T>     first,
+                         ori::global_ptr<T>     last,
+                         std::size_t            s,
+                         Predicate              pred) {
+  std::size_t n = std::distance(first, last);
+  std::size_t b = select_block_size(policy, sizeof(T));
+  std::size_t m = (n + b - 1) / b;
+
+  auto seq_policy   = execution::internal::to_sequenced_policy(policy);
+  auto block_policy = select_block_policy(policy);
+
+  auto block_range = [=](std::size_t i, std::size_t lo, std::size_t hi) {
+    return std::make_pair(std::clamp(i * b, lo, hi), std::clamp(std::min(n, (i + 1) * b), lo, hi));
+  };
+
+  ori::global_ptr<partition_at_block> blocks = ori::malloc<partition_at_block>(m);
+
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(blocks, checkout_mode::write),
+      [=](std::size_t i, partition_at_block& blk) {
+        std::size_t l = 0, r = 0;
+        for_each_aux(
+            seq_policy,
+            [&](const T& x, std::size_t j) {
+              bool p = pred(x, j);
+              l += (j < s && !p);
+              r += (j >= s && p);
+            },
+            make_global_iterator(first + i * b                 , checkout_mode::read),
+            make_global_iterator(first + std::min(n, (i + 1) * b), checkout_mode::read),
+            count_iterator<std::size_t>(i * b));
+        blk = partition_at_block{l, r, 0, 0};
+      });
+
+  std::size_t l_total = 0, r_total = 0;
+  for_each(
+      execution::sequenced_policy(b),
+      make_global_iterator(blocks    , checkout_mode::read_write),
+      make_global_iterator(blocks + m, checkout_mode::read_write),
+      [&](partition_at_block& blk) {
+        blk.l_offset = l_total;
+        blk.r_offset = r_total;
+        l_total += blk.l_count;
+        r_total += blk.r_count;
+      });
+
+  ITYR_CHECK(l_total == r_total);
+
+  if (l_total == 0) {
+    ori::free(blocks, m);
+    return;
+  }
+
+  ori::global_ptr<T> buf = ori::malloc<T>(l_total);
+
+  // Gather the misplaced elements after `s` in the buffer
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(blocks, checkout_mode::read),
+      [=](std::size_t i, const partition_at_block& blk) {
+        if (blk.r_count == 0) return;
+        auto [lo, hi] = block_range(i, s, n);
+        std::size_t t = blk.r_offset;
+        for_each_chunk_aux(
+            seq_policy,
+            [&](std::size_t c, const T* xs, count_iterator<std::size_t> idx) {
+              std::size_t cnt = 0;
+              for (std::size_t j = 0; j < c; j++) cnt += pred(xs[j], idx[j]);
+              if (cnt == 0) return;
+              auto cs = make_checkout(buf + t, cnt, checkout_mode::write);
+              std::size_t u = 0;
+              for (std::size_t j = 0; j < c; j++) {
+                if (pred(xs[j], idx[j])) cs[u++] = xs[j];
+              }
+              t += cnt;
+            },
+            make_global_iterator(first + lo, checkout_mode::read),
+            make_global_iterator(first + hi, checkout_mode::read),
+            count_iterator<std::size_t>(lo));
+      });
+
+  // Exchange them with the misplaced elements before `s`
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(blocks, checkout_mode::read),
+      [=](std::size_t i, const partition_at_block& blk) {
+        if (blk.l_count == 0) return;
+        auto [lo, hi] = block_range(i, 0, s);
+        std::size_t t = blk.l_offset;
+        for_each_chunk_aux(
+            seq_policy,
+            [&](std::size_t c, T* xs, count_iterator<std::size_t> idx) {
+              std::size_t cnt = 0;
+              for (std::size_t j = 0; j < c; j++) cnt += !pred(xs[j], idx[j]);
+              if (cnt == 0) return;
+              auto cs = make_checkout(buf + t, cnt, checkout_mode::read_write);
+              std::size_t u = 0;
+              for (std::size_t j = 0; j < c; j++) {
+                if (!pred(xs[j], idx[j])) std::swap(xs[j], cs[u++]);
+              }
+              t += cnt;
+            },
+            make_global_iterator(first + lo, checkout_mode::read_write),
+            make_global_iterator(first + hi, checkout_mode::read_write),
+            count_iterator<std::size_t>(lo));
+      });
+
+  // Scatter the exchanged elements to the positions of the misplaced elements after `s`
+  for_each(
+      block_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(m),
+      make_global_iterator(blocks, checkout_mode::read),
+      [=](std::size_t i, const partition_at_block& blk) {
+        if (blk.r_count == 0) return;
+        auto [lo, hi] = block_range(i, s, n);
+        std::size_t t = blk.r_offset;
+        for_each_chunk_aux(
+            seq_policy,
+            [&](std::size_t c, T* xs, count_iterator<std::size_t> idx) {
+              std::size_t cnt = 0;
+              for (std::size_t j = 0; j < c; j++) cnt += pred(xs[j], idx[j]);
+              if (cnt == 0) return;
+              auto cs = make_checkout(buf + t, cnt, checkout_mode::read);
+              std::size_t u = 0;
+              for (std::size_t j = 0; j < c; j++) {
+                if (pred(xs[j], idx[j])) xs[j] = cs[u++];
+              }
+              t += cnt;
+            },
+            make_global_iterator(first + lo, checkout_mode::read_write),
+            make_global_iterator(first + hi, checkout_mode::read_write),
+            count_iterator<std::size_t>(lo));
+      });
+
+  ori::free(buf, l_total);
+  ori::free(blocks, m);
+}
+
+template <typename ExecutionPolicy, typename T, typename Compare>
+inline void nth_element(const ExecutionPolicy& policy,
+                        ori::global_ptr<T>     first,
+                        ori::global_ptr<T>     nth,
+                        ori::global_ptr<T>     last,
+                        Compare                comp) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Parallel selection requires trivially copyable elements");
+
+  if (nth == last) return;
+
+  std::size_t k = std::distance(first, nth);
+
+  auto v = select_kth(policy,
+                      make_global_iterator(first, checkout_mode::read),
+                      make_global_iterator(last , checkout_mode::read),
+                      k, comp);
+
+  select_order<Compare> lt {comp};
+  partition_at(policy, first, last, k,
+               [=](const T& x, std::size_t i) { return lt(x, i, v); });
+
+  // `[nth, last)` consists of the elements not smaller than `v`, and one of those equivalent to `v`
+  // is placed at `nth`
+  auto it = find_if(policy, nth, last, [=](const T& x) { return !comp(v.value, x); });
+  ITYR_CHECK(it != last);
+  if (it != nth) {
+    T x = (*it).get();
+    *it = (*nth).get();
+    *nth = x;
+  }
+}
+
+template <typename ExecutionPolicy, typename T, typename Compare>
+inline std::size_t partial_sort_copy(const ExecutionPolicy& policy,
+                                     ori::global_ptr<T>     first,
+                                     ori::global_ptr<T>     last,
+                                     ori::global_ptr<T>     first_d,
+                                     std::size_t            r,
+                                     Compare                comp) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Parallel selection requires trivially copyable elements");
+
+  std::size_t n = std::distance(first, last);
+  r = std::min(r, n);
+
+  if (r == 0) return 0;
+
+  auto first_r = make_global_iterator(first, checkout_mode::read);
+  auto last_r  = make_global_iterator(last , checkout_mode::read);
+
+  if (r == n) {
+    copy(policy, first, last, first_d);
+  } else {
+    auto v = select_kth(policy, first_r, last_r, r, comp);
+
+    select_order<Compare> lt {comp};
+    auto last_d = copy_if_generic(policy, [=](const T& x, std::size_t i) { return lt(x, i, v); },
+                                  first_r, last_r, make_global_iterator(first_d, checkout_mode::write),
+                                  count_iterator<std::size_t>(0));
+    ITYR_CHECK(std::size_t(std::distance(make_global_iterator(first_d, checkout_mode::write), last_d)) == r);
+  }
+
+  sort(policy, first_d, first_d + r, comp);
+
+  return r;
+}
+
+}
+
+/**
+ * @brief Partially sort a range so that the n-th element is in its sorted position.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param nth    Iterator to the position to be sorted.
+ * @param last   End iterator.
+ * @param comp   Binary comparison operator.
+ *
+ * This function rearranges the elements in the range `[first, last)` so that the element at `nth`
+ * is the one that would be there if the range were sorted, all elements before `nth` are not
+ * greater than it, and all elements after `nth` are not less than it.
+ *
+ * If global pointers are provided as iterators, the element at `nth` is selected without
+ * modifying the range by repeatedly narrowing down a window of candidates: in each round, a random
+ * sample of the candidates is drawn, two pivots around the expected rank are chosen from the
+ * sample, and the candidates smaller than each pivot are counted in parallel (as
+ * `ityr::transform_reduce()`). After that, only the elements on the wrong side of `nth` are
+ * exchanged through a temporary buffer. Thus, the whole range is read and written only a few times,
+ * in contrast to `ityr::sort()`. Elements must be *trivially copyable* in this case.
+ * Otherwise, `std::nth_element()` is called.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {5, 2, 4, 1, 3};
+ * ityr::nth_element(ityr::execution::par, v.begin(), v.begin() + 2, v.end(), std::less<>{});
+ * // v[2] = 3, v[0], v[1] <= 3 and v[3], v[4] >= 3
+ * ```
+ *
+ * @see [std::nth_element -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/nth_element)
+ * @see `ityr::partial_sort()`
+ * @see `ityr::top_k()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+inline void nth_element(const ExecutionPolicy& policy,
+                        RandomAccessIterator   first,
+                        RandomAccessIterator   nth,
+                        RandomAccessIterator   last,
+                        Compare                comp) {
+  if constexpr (ori::is_global_ptr_v<RandomAccessIterator>) {
+    internal::nth_element(policy, first, nth, last, comp);
+  } else {
+    std::nth_element(first, nth, last, comp);
+  }
+}
+
+/**
+ * @brief Partially sort a range so that the n-th element is in its sorted position.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param nth    Iterator to the position to be sorted.
+ * @param last   End iterator.
+ *
+ * Equivalent to `ityr::nth_element(policy, first, nth, last, std::less<>{})`.
+ *
+ * @see [std::nth_element -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/nth_element)
+ * @see `ityr::partial_sort()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator>
+inline void nth_element(const ExecutionPolicy& policy,
+                        RandomAccessIterator   first,
+                        RandomAccessIterator   nth,
+                        RandomAccessIterator   last) {
+  nth_element(policy, first, nth, last, std::less<>{});
+}
+
+/**
+ * @brief Sort the smallest elements of a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param middle End iterator of the range to be sorted.
+ * @param last   End iterator.
+ * @param comp   Binary comparison operator.
+ *
+ * This function rearranges the elements in the range `[first, last)` so that the range
+ * `[first, middle)` contains the `middle - first` smallest elements in sorted order.
+ * The order of the remaining elements is unspecified.
+ *
+ * This is implemented as `ityr::nth_element()` followed by `ityr::sort()` of `[first, middle)`.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {5, 2, 4, 1, 3};
+ * ityr::partial_sort(ityr::execution::par, v.begin(), v.begin() + 2, v.end(), std::less<>{});
+ * // v = {1, 2, ?, ?, ?}
+ * ```
+ *
+ * @see [std::partial_sort -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/partial_sort)
+ * @see `ityr::nth_element()`
+ * @see `ityr::partial_sort_copy()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+inline void partial_sort(const ExecutionPolicy& policy,
+                         RandomAccessIterator   first,
+                         RandomAccessIterator   middle,
+                         RandomAccessIterator   last,
+                         Compare                comp) {
+  if (first == middle) return;
+  nth_element(policy, first, middle, last, comp);
+  sort(policy, first, middle, comp);
+}
+
+/**
+ * @brief Sort the smallest elements of a range.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param middle End iterator of the range to be sorted.
+ * @param last   End iterator.
+ *
+ * Equivalent to `ityr::partial_sort(policy, first, middle, last, std::less<>{})`.
+ *
+ * @see [std::partial_sort -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/partial_sort)
+ * @see `ityr::nth_element()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator>
+inline void partial_sort(const ExecutionPolicy& policy,
+                         RandomAccessIterator   first,
+                         RandomAccessIterator   middle,
+                         RandomAccessIterator   last) {
+  partial_sort(policy, first, middle, last, std::less<>{});
+}
+
+/**
+ * @brief Copy the smallest elements of a range to another range in sorted order.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first   Input begin iterator.
+ * @param last    Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param last_d  Output end iterator.
+ * @param comp    Binary comparison operator.
+ *
+ * @return The end iterator of the sorted output (`first_d + min(last - first, last_d - first_d)`).
+ *
+ * This function copies the `r = min(last - first, last_d - first_d)` smallest elements in the
+ * input range `[first, last)` to the output range `[first_d, first_d + r)` in sorted order.
+ * The input range is not modified.
+ *
+ * If global pointers are provided as iterators, the r-th smallest element is selected as in
+ * `ityr::nth_element()` without modifying the input range, the elements smaller than it are copied
+ * in parallel (as `ityr::copy_if()`), and then only the output range is sorted.
+ * Elements must be *trivially copyable* in this case.
+ * Otherwise, `std::partial_sort_copy()` is called.
+ *
+ * The input and output regions should not be overlapped.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v1 = {5, 2, 4, 1, 3};
+ * ityr::global_vector<int> v2(3);
+ * ityr::partial_sort_copy(ityr::execution::par, v1.begin(), v1.end(), v2.begin(), v2.end(),
+ *                         std::less<>{});
+ * // v2 = {1, 2, 3}
+ * ```
+ *
+ * @see [std::partial_sort_copy -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy)
+ * @see `ityr::partial_sort()`
+ * @see `ityr::top_k()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIteratorD,
+          typename Compare>
+inline RandomAccessIteratorD partial_sort_copy(const ExecutionPolicy& policy,
+                                               RandomAccessIterator1  first,
+                                               RandomAccessIterator1  last,
+                                               RandomAccessIteratorD  first_d,
+                                               RandomAccessIteratorD  last_d,
+                                               Compare                comp) {
+  if constexpr (ori::is_global_ptr_v<RandomAccessIterator1> &&
+                ori::is_global_ptr_v<RandomAccessIteratorD>) {
+    std::size_t r = internal::partial_sort_copy(policy, first, last, first_d,
+                                                std::distance(first_d, last_d), comp);
+    return std::next(first_d, r);
+  } else {
+    return std::partial_sort_copy(first, last, first_d, last_d, comp);
+  }
+}
+
+/**
+ * @brief Copy the smallest elements of a range to another range in sorted order.
+ *
+ * @param policy  Execution policy (`ityr::execution`).
+ * @param first   Input begin iterator.
+ * @param last    Input end iterator.
+ * @param first_d Output begin iterator.
+ * @param last_d  Output end iterator.
+ *
+ * @return The end iterator of the sorted output (`first_d + min(last - first, last_d - first_d)`).
+ *
+ * Equivalent to `ityr::partial_sort_copy(policy, first, last, first_d, last_d, std::less<>{})`.
+ *
+ * @see [std::partial_sort_copy -- cppreference.com](https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy)
+ * @see `ityr::top_k()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIteratorD>
+inline RandomAccessIteratorD partial_sort_copy(const ExecutionPolicy& policy,
+                                               RandomAccessIterator1  first,
+                                               RandomAccessIterator1  last,
+                                               RandomAccessIteratorD  first_d,
+                                               RandomAccessIteratorD  last_d) {
+  return partial_sort_copy(policy, first, last, first_d, last_d, std::less<>{});
+}
+
+/**
+ * @brief Get the k smallest elements of a range in sorted order.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param k      Number of elements.
+ * @param comp   Binary comparison operator.
+ *
+ * @return A global vector (`ityr::global_vector`) of the `min(k, last - first)` smallest elements
+ *         in sorted order.
+ *
+ * The input range is not modified. To get the k largest elements, specify `std::greater<>{}` as
+ * `comp`. See `ityr::partial_sort_copy()` for the implementation.
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<int> v = {5, 2, 4, 1, 3};
+ * ityr::global_vector<int> t = ityr::top_k(ityr::execution::par, v.begin(), v.end(), 2,
+ *                                          std::greater<>{});
+ * // t = {5, 4}
+ * ```
+ *
+ * @see `ityr::partial_sort_copy()`
+ * @see `ityr::nth_element()`
+ * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+inline auto top_k(const ExecutionPolicy& policy,
+                  RandomAccessIterator   first,
+                  RandomAccessIterator   last,
+                  std::size_t            k,
+                  Compare                comp) {
+  using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+  std::size_t r = std::min<std::size_t>(k, std::distance(first, last));
+  if (r == 0) {
+    return global_vector<value_type>();
+  }
+  global_vector<value_type> ret(r);
+  partial_sort_copy(policy, first, last, ret.begin(), ret.end(), comp);
+  return ret;
+}
+
+/**
+ * @brief Get the k smallest elements of a range in sorted order.
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin iterator.
+ * @param last   End iterator.
+ * @param k      Number of elements.
+ *
+ * @return A global vector (`ityr::global_vector`) of the `min(k, last - first)` smallest elements
+ *         in sorted order.
+ *
+ * Equivalent to `ityr::top_k(policy, first, last, k, std::less<>{})`.
+ *
+ * @see `ityr::partial_sort_copy()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator>
+inline auto top_k(const ExecutionPolicy& policy,
+                  RandomAccessIterator   first,
+                  RandomAccessIterator   last,
+                  std::size_t            k) {
+  return top_k(policy, first, last, k, std::less<>{});
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_select] nth_element") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n);
+
+  auto check_nth = [=](long k, auto comp) {
+    long v = p[k].get();
+    bool ok = all_of(execution::parallel_policy(100), p, p + k,
+                     [=](long x) { return !comp(v, x); }) &&
+              all_of(execution::parallel_policy(100), p + k, p + n,
+                     [=](long x) { return !comp(x, v); });
+    ITYR_CHECK(ok);
+    return v;
+  };
+
+  ITYR_SUBCASE("distinct elements") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(100),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return long(internal::sample_sort_hash(i) % n); });
+
+      long sum = reduce(execution::par, p, p + n);
+
+      for (long k : {0L, 1L, n / 3, n / 2, n - 1}) {
+        nth_element(execution::parallel_policy(100), p, p + k, p + n);
+        check_nth(k, std::less<>{});
+      }
+
+      ITYR_CHECK(reduce(execution::par, p, p + n) == sum);
+    });
+  }
+
+  ITYR_SUBCASE("many duplicates") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(100),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return long(internal::sample_sort_hash(i) % 7); });
+
+      for (long k : {0L, n / 7, n / 2, n - 1}) {
+        nth_element(execution::parallel_policy(100), p, p + k, p + n, std::greater<>{});
+        check_nth(k, std::greater<>{});
+      }
+    });
+  }
+
+  ITYR_SUBCASE("serial") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(100),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return n - i; });
+
+      nth_element(execution::sequenced_policy(100), p, p + n / 4, p + n);
+      long v = check_nth(n / 4, std::less<>{});
+      ITYR_CHECK(v == n / 4 + 1);
+    });
+  }
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_select] partial_sort and top_k") {
+  ito::init();
+  ori::init();
+
+  long n = 100000;
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n);
+
+  ito::root_exec([=] {
+    // A permutation of [0, n) (n is not a multiple of 7)
+    transform(
+        execution::parallel_policy(100),
+        count_iterator<long>(0), count_iterator<long>(n), p,
+        [=](long i) { return i * 7 % n; });
+  });
+
+  ITYR_SUBCASE("partial_sort") {
+    ito::root_exec([=] {
+      long k = 1000;
+      partial_sort(execution::parallel_policy(100), p, p + k, p + n);
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(p    , checkout_mode::read),
+          make_global_iterator(p + k, checkout_mode::read),
+          count_iterator<long>(0),
+          [](long x, long i) { ITYR_CHECK(x == i); });
+    });
+  }
+
+  ITYR_SUBCASE("partial_sort_copy") {
+    ito::root_exec([=] {
+      long k = 5000;
+      ori::global_ptr<long> d = ori::malloc<long>(k);
+
+      auto e = partial_sort_copy(execution::parallel_policy(100), p, p + n, d, d + k,
+                                 std::greater<>{});
+      ITYR_CHECK(e == d + k);
+      for_each(
+          execution::parallel_policy(100),
+          make_global_iterator(d    , checkout_mode::read),
+          make_global_iterator(d + k, checkout_mode::read),
+          count_iterator<long>(0),
+          [=](long x, long i) { ITYR_CHECK(x == n - 1 - i); });
+
+      // The input range is not modified
+      bool unmodified = all_of(execution::parallel_policy(100),
+                               count_iterator<long>(0), count_iterator<long>(n),
+                               [=](long i) { return p[i].get() == i * 7 % n; });
+      ITYR_CHECK(unmodified);
+
+      ori::free(d, k);
+    });
+  }
+
+  ITYR_SUBCASE("top_k") {
+    ito::root_exec([=] {
+      global_vector<long> t1 = top_k(execution::par, p, p + n, 10);
+      ITYR_CHECK(t1 == global_vector<long>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+      global_vector<long> t2 = top_k(execution::par, p, p + n, 3, std::greater<>{});
+      ITYR_CHECK(t2 == global_vector<long>({n - 1, n - 2, n - 3}));
+
+      global_vector<long> t3 = top_k(execution::par, p, p + 5, 10);
+      ITYR_CHECK(t3.size() == 5);
+      ITYR_CHECK(is_sorted(execution::par, t3.begin(), t3.end()));
+
+      global_vector<long> t4 = top_k(execution::par, p, p + n, 0);
+      ITYR_CHECK(t4.empty());
+    });
+  }
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
+}
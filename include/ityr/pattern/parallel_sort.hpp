@@ -1,8 +1,15 @@
 #pragma once
 
+#include <array>
+#include <vector>
+#include <numeric>
+#include <cstring>
+
 #include "ityr/common/util.hpp"
+#include "ityr/common/topology.hpp"
 #include "ityr/pattern/parallel_invoke.hpp"
 #include "ityr/pattern/parallel_loop.hpp"
+#include "ityr/pattern/parallel_reduce.hpp"
 #include "ityr/pattern/parallel_merge.hpp"
 
 namespace ityr {
@@ -34,6 +41,412 @@ inline void merge_sort(const execution::parallel_policy<W>& policy,
   }
 }
 
+// Stateless mixing function (the finalizer of SplitMix64) to pick sample positions
+inline uint64_t sample_sort_hash(uint64_t x) {
+  x += 0x9e3779b97f4a7c15;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+  return x ^ (x >> 31);
+}
+
+template <typename T, typename Compare>
+inline std::size_t sample_sort_bucket(const T* splitters, std::size_t n_splitters,
+                                      const T& x, Compare comp) {
+  return std::upper_bound(splitters, splitters + n_splitters, x, comp) - splitters;
+}
+
+// Distributed sample sort:
+// 1. Splitters are selected from stratified random samples.
+// 2. The number of elements in each (block, bucket) pair is counted in parallel.
+//    The counts are laid out bucket-major, so that their exclusive scan gives the position of
+//    each (block, bucket) pair in the sorted range.
+// 3. Each block scatters its elements to the buffers of buckets, which are allocated by
+//    distributed tasks (i.e., the all-to-all exchange).
+// 4. Each bucket is sorted in its buffer and copied back to the range.
+template <typename W, typename T, typename Compare>
+inline void sample_sort(const execution::parallel_policy<W>& policy,
+                        ori::global_ptr<T>                   first,
+                        ori::global_ptr<T>                   last,
+                        Compare                              comp) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Sample sort requires trivially copyable elements");
+
+  constexpr std::size_t oversampling = 32;
+
+  std::size_t n = std::distance(first, last);
+
+  // Blocks are at least as large as leaf tasks and cache blocks; each block is checked out at once
+  std::size_t b = std::max(policy.cutoff_count, ori::block_size / sizeof(T));
+  std::size_t k = std::min(std::size_t(common::topology::n_ranks()) * 16, b / 16);
+
+  // For sorting buckets and scanning the counts (the given work hints do not apply to them)
+  execution::parallel_policy inner_policy(b);
+  inner_policy.fork_policy = policy.fork_policy;
+  inner_policy.lazy_split  = policy.lazy_split;
+
+  if (n <= b || k < 2) {
+    merge_sort<false>(inner_policy,
+                      make_global_iterator(first, checkout_mode::read_write),
+                      make_global_iterator(last , checkout_mode::read_write),
+                      comp);
+    return;
+  }
+
+  std::size_t nb = (n + b - 1) / b;
+  std::size_t ns = std::min(n, k * oversampling);
+
+  // for loops over blocks and buckets
+  execution::parallel_policy loop_policy(1);
+  loop_policy.fork_policy = policy.fork_policy;
+  loop_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<T>                  samples   = ori::malloc<T>(ns);
+  ori::global_ptr<T>                  splitters = ori::malloc<T>(k - 1);
+  ori::global_ptr<std::size_t>        counts    = ori::malloc<std::size_t>(k * nb);
+  ori::global_ptr<std::size_t>        starts    = ori::malloc<std::size_t>(k + 1);
+  ori::global_ptr<ori::global_ptr<T>> bufs      = ori::malloc<ori::global_ptr<T>>(k);
+
+  // 1. Select splitters
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(ns),
+      make_global_iterator(samples, checkout_mode::write),
+      [=](std::size_t i, T& s) {
+        std::size_t lo = i * n / ns;
+        std::size_t hi = (i + 1) * n / ns;
+        s = first[lo + sample_sort_hash(i) % (hi - lo)].get();
+      });
+
+  {
+    auto [s_cs, sp_cs] = make_checkouts(samples  , ns   , checkout_mode::read_write,
+                                        splitters, k - 1, checkout_mode::write);
+    std::sort(s_cs.begin(), s_cs.end(), comp);
+    for (std::size_t j = 0; j < k - 1; j++) {
+      sp_cs[j] = s_cs[(j + 1) * ns / k];
+    }
+  }
+
+  // 2. Count the elements in each (block, bucket) pair
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(nb),
+      [=](std::size_t i) {
+        std::size_t d = std::min(n - i * b, b);
+        auto [blk_cs, sp_cs] = make_checkouts(first + i * b, d    , checkout_mode::read,
+                                              splitters    , k - 1, checkout_mode::read);
+
+        std::vector<std::size_t> cnt(k);
+        for (const T& x : blk_cs) {
+          cnt[sample_sort_bucket(sp_cs.data(), k - 1, x, comp)]++;
+        }
+
+        for (std::size_t j = 0; j < k; j++) {
+          counts[j * nb + i] = cnt[j];
+        }
+      });
+
+  exclusive_scan(inner_policy, counts, counts + k * nb, counts);
+
+  // 3. Allocate bucket buffers and scatter the elements of each block to them
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(k + 1),
+      make_global_iterator(starts, checkout_mode::write),
+      [=](std::size_t j, std::size_t& s) {
+        s = (j < k) ? counts[j * nb].get() : n;
+      });
+
+  for_each(
+      loop_policy,
+      make_global_iterator(starts    , checkout_mode::read),
+      make_global_iterator(starts + k, checkout_mode::read),
+      make_global_iterator(starts + 1, checkout_mode::read),
+      make_global_iterator(bufs      , checkout_mode::write),
+      [=](std::size_t s, std::size_t e, ori::global_ptr<T>& buf) {
+        // allocated in the local memory of the process executing this task
+        buf = (e > s) ? ori::malloc<T>(e - s) : ori::global_ptr<T>{};
+      });
+
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(nb),
+      [=](std::size_t i) {
+        std::size_t d = std::min(n - i * b, b);
+        auto [blk_cs, sp_cs, st_cs, bufs_cs] =
+          make_checkouts(first + i * b, d    , checkout_mode::read,
+                         splitters    , k - 1, checkout_mode::read,
+                         starts       , k + 1, checkout_mode::read,
+                         bufs         , k    , checkout_mode::read);
+
+        // Group the elements of this block by bucket (counting sort)
+        std::vector<std::size_t> offsets(k + 1);
+        std::vector<std::size_t> bucket_ids(d);
+        for (std::size_t l = 0; l < d; l++) {
+          bucket_ids[l] = sample_sort_bucket(sp_cs.data(), k - 1, blk_cs[l], comp);
+          offsets[bucket_ids[l] + 1]++;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::vector<T> grouped(d);
+        std::vector<std::size_t> heads(offsets.begin(), offsets.end() - 1);
+        for (std::size_t l = 0; l < d; l++) {
+          grouped[heads[bucket_ids[l]]++] = blk_cs[l];
+        }
+
+        for (std::size_t j = 0; j < k; j++) {
+          std::size_t c = offsets[j + 1] - offsets[j];
+          if (c > 0) {
+            std::size_t pos = counts[j * nb + i].get() - st_cs[j];
+            auto cs = make_checkout(bufs_cs[j] + pos, c, checkout_mode::write);
+            std::copy(grouped.begin() + offsets[j], grouped.begin() + offsets[j + 1], cs.begin());
+          }
+        }
+      });
+
+  // 4. Sort each bucket and copy it back to the range
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(k),
+      [=](std::size_t j) {
+        // Not checked out by for_each(), as parallelism is nested
+        std::size_t        s   = starts[j].get();
+        std::size_t        e   = starts[j + 1].get();
+        ori::global_ptr<T> buf = bufs[j].get();
+        if (e == s) return;
+
+        if (e - s <= b) {
+          auto [buf_cs, dest_cs] = make_checkouts(buf      , e - s, checkout_mode::read_write,
+                                                  first + s, e - s, checkout_mode::write);
+          std::sort(buf_cs.begin(), buf_cs.end(), comp);
+          std::copy(buf_cs.begin(), buf_cs.end(), dest_cs.begin());
+        } else {
+          merge_sort<false>(inner_policy,
+                            make_global_iterator(buf        , checkout_mode::read_write),
+                            make_global_iterator(buf + e - s, checkout_mode::read_write),
+                            comp);
+          copy(inner_policy, buf, buf + e - s, first + s);
+        }
+
+        ori::free(buf, e - s);
+      });
+
+  ori::free(samples, ns);
+  ori::free(splitters, k - 1);
+  ori::free(counts, k * nb);
+  ori::free(starts, k + 1);
+  ori::free(bufs, k);
+}
+
+// Maps a key to an unsigned integer of the same width that preserves the order of keys
+template <typename Key>
+inline auto radix_sort_ordered_bits(Key key) {
+  static_assert((std::is_integral_v<Key> && !std::is_same_v<Key, bool>) ||
+                (std::is_floating_point_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8)),
+                "Radix sort keys must be integers or single/double-precision floating point numbers");
+
+  if constexpr (std::is_integral_v<Key>) {
+    using U = std::make_unsigned_t<Key>;
+    U u = static_cast<U>(key);
+    if constexpr (std::is_signed_v<Key>) {
+      u ^= U(1) << (sizeof(U) * 8 - 1);
+    }
+    return u;
+  } else {
+    using U = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+    U u;
+    std::memcpy(&u, &key, sizeof(U));
+    constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+    return (u & sign) ? U(~u) : U(u | sign);
+  }
+}
+
+inline constexpr int         radix_sort_digit_bits = 8;
+inline constexpr std::size_t radix_sort_n_digits   = std::size_t(1) << radix_sort_digit_bits;
+
+// The range or the temporary buffer that radix sort ping-pongs between. The temporary buffer
+// consists of per-block chunks allocated by distributed tasks.
+template <typename T>
+struct radix_sort_storage {
+  ori::global_ptr<T>                  first;
+  ori::global_ptr<ori::global_ptr<T>> chunks;
+  std::size_t                         b;
+
+  ori::global_ptr<T> block(std::size_t i) const {
+    return chunks ? chunks[i].get() : first + i * b;
+  }
+
+  // Write `c` elements to the `p`-th position onward
+  void write(std::size_t p, const T* src, std::size_t c) const {
+    if (!chunks) {
+      auto cs = make_checkout(first + p, c, checkout_mode::write);
+      std::copy(src, src + c, cs.begin());
+      return;
+    }
+    while (c > 0) {
+      std::size_t off = p % b;
+      std::size_t len = std::min(c, b - off);
+      auto cs = make_checkout(chunks[p / b].get() + off, len, checkout_mode::write);
+      std::copy(src, src + len, cs.begin());
+      p += len; src += len; c -= len;
+    }
+  }
+};
+
+template <typename W, typename T, typename KeyFn>
+inline void radix_sort(const execution::parallel_policy<W>& policy,
+                       ori::global_ptr<T>                   first,
+                       ori::global_ptr<T>                   last,
+                       KeyFn                                key_fn) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Radix sort requires trivially copyable elements");
+
+  using bits_t = decltype(radix_sort_ordered_bits(key_fn(std::declval<const T&>())));
+
+  constexpr int         digit_bits = radix_sort_digit_bits;
+  constexpr std::size_t n_digits   = radix_sort_n_digits;
+  constexpr int         n_passes   = sizeof(bits_t) * 8 / digit_bits;
+
+  std::size_t n = std::distance(first, last);
+  if (n <= 1) return;
+
+  // Blocks are at least as large as leaf tasks and cache blocks; each block is checked out at once
+  std::size_t b  = std::max(policy.cutoff_count, ori::block_size / sizeof(T));
+  std::size_t nb = (n + b - 1) / b;
+
+  // For loops over blocks and for scanning the counts (the given work hints do not apply to them)
+  execution::parallel_policy loop_policy(1);
+  loop_policy.fork_policy = policy.fork_policy;
+  loop_policy.lazy_split  = policy.lazy_split;
+
+  execution::parallel_policy inner_policy(b);
+  inner_policy.fork_policy = policy.fork_policy;
+  inner_policy.lazy_split  = policy.lazy_split;
+
+  ori::global_ptr<std::size_t>        counts = ori::malloc<std::size_t>(n_digits * nb);
+  ori::global_ptr<ori::global_ptr<T>> chunks = ori::malloc<ori::global_ptr<T>>(nb);
+
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(nb),
+      make_global_iterator(chunks, checkout_mode::write),
+      [=](std::size_t i, ori::global_ptr<T>& c) {
+        // allocated in the local memory of the process executing this task
+        c = ori::malloc<T>(std::min(n - i * b, b));
+      });
+
+  radix_sort_storage<T> src {first, nullptr, b};
+  radix_sort_storage<T> dst {nullptr, chunks, b};
+
+  for (int pass = 0; pass < n_passes; pass++) {
+    int shift = pass * digit_bits;
+    auto digit_of = [=](const T& x) {
+      return std::size_t(radix_sort_ordered_bits(key_fn(x)) >> shift) & (n_digits - 1);
+    };
+
+    // Privatized histogram of each block, laid out digit-major so that its exclusive scan gives
+    // the position of each (block, digit) pair after this pass
+    for_each(
+        loop_policy,
+        count_iterator<std::size_t>(0),
+        count_iterator<std::size_t>(nb),
+        [=](std::size_t i) {
+          std::size_t d = std::min(n - i * b, b);
+          auto cs = make_checkout(src.block(i), d, checkout_mode::read);
+
+          std::array<std::size_t, radix_sort_n_digits> hist {};
+          for (const T& x : cs) {
+            hist[digit_of(x)]++;
+          }
+
+          for (std::size_t k = 0; k < n_digits; k++) {
+            counts[k * nb + i] = hist[k];
+          }
+        });
+
+    exclusive_scan(inner_policy, counts, counts + n_digits * nb, counts);
+
+    // Skip this pass if all keys have the same digit
+    bool skip = transform_reduce(
+        loop_policy,
+        count_iterator<std::size_t>(0),
+        count_iterator<std::size_t>(n_digits),
+        reducer::logical_or{},
+        [=](std::size_t k) {
+          std::size_t s = counts[k * nb].get();
+          std::size_t e = (k + 1 < n_digits) ? counts[(k + 1) * nb].get() : n;
+          return e - s == n;
+        });
+    if (skip) continue;
+
+    // Each block is grouped by digit locally, and then each group is written to the
+    // destination as a contiguous run (rather than element by element)
+    for_each(
+        loop_policy,
+        count_iterator<std::size_t>(0),
+        count_iterator<std::size_t>(nb),
+        [=](std::size_t i) {
+          std::size_t d = std::min(n - i * b, b);
+          auto cs = make_checkout(src.block(i), d, checkout_mode::read);
+
+          std::array<std::size_t, radix_sort_n_digits + 1> offsets {};
+          std::vector<uint8_t> digits(d);
+          for (std::size_t l = 0; l < d; l++) {
+            digits[l] = digit_of(cs[l]);
+            offsets[digits[l] + 1]++;
+          }
+          std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+          std::vector<T> grouped(d);
+          std::array<std::size_t, radix_sort_n_digits> heads;
+          std::copy(offsets.begin(), offsets.end() - 1, heads.begin());
+          for (std::size_t l = 0; l < d; l++) {
+            grouped[heads[digits[l]]++] = cs[l];
+          }
+
+          for (std::size_t k = 0; k < n_digits; k++) {
+            std::size_t c = offsets[k + 1] - offsets[k];
+            if (c > 0) {
+              dst.write(counts[k * nb + i].get(), grouped.data() + offsets[k], c);
+            }
+          }
+        });
+
+    std::swap(src, dst);
+  }
+
+  if (src.chunks) {
+    // The result is in the temporary buffer
+    for_each(
+        loop_policy,
+        count_iterator<std::size_t>(0),
+        count_iterator<std::size_t>(nb),
+        [=](std::size_t i) {
+          std::size_t d = std::min(n - i * b, b);
+          auto [src_cs, dst_cs] = make_checkouts(src.block(i), d, checkout_mode::read,
+                                                 first + i * b, d, checkout_mode::write);
+          std::copy(src_cs.begin(), src_cs.end(), dst_cs.begin());
+        });
+  }
+
+  for_each(
+      loop_policy,
+      count_iterator<std::size_t>(0),
+      count_iterator<std::size_t>(nb),
+      make_global_iterator(chunks, checkout_mode::read),
+      [=](std::size_t i, ori::global_ptr<T> c) {
+        ori::free(c, std::min(n - i * b, b));
+      });
+
+  ori::free(counts, n_digits * nb);
+  ori::free(chunks, nb);
+}
+
 }
 
 /**
@@ -188,6 +601,14 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_sort] stable_sort") {
  * This function sorts the given range (`[first, last)`) in place.
  * This sort may not be stable.
  *
+ * By default, the range is sorted by parallel merge sort, in which elements are moved
+ * O(log n) times. If the policy enables sample sort (e.g., `ityr::execution::par_sample`) and
+ * global pointers to trivially copyable elements are given, elements are distributed to buckets
+ * by sampled splitters in a single all-to-all exchange, and then each bucket is sorted
+ * independently and copied back to the range. The temporary buffers of buckets are allocated
+ * from the noncollective heaps of the processes executing the corresponding tasks, and require
+ * as much memory as the range in total (see `ITYR_ORI_NONCOLL_ALLOCATOR_SIZE`).
+ *
  * If global pointers are provided as iterators, they are automatically checked out with the read-write
  * mode in the specified granularity (`ityr::execution::sequenced_policy::checkout_count` if serial,
  * or `ityr::execution::parallel_policy::checkout_count` if parallel) without explicitly passing them
@@ -204,7 +625,8 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_sort] stable_sort") {
  * @see `ityr::stable_sort()`
  * @see `ityr::is_sorted()`
  * @see `ityr::execution::sequenced_policy`, `ityr::execution::seq`,
- *      `ityr::execution::parallel_policy`, `ityr::execution::par`
+ *      `ityr::execution::parallel_policy`, `ityr::execution::par`,
+ *      `ityr::execution::par_sample`
  */
 template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
 inline void sort(const ExecutionPolicy& policy,
@@ -212,6 +634,14 @@ inline void sort(const ExecutionPolicy& policy,
                  RandomAccessIterator   last,
                  Compare                comp) {
   if constexpr (ori::is_global_ptr_v<RandomAccessIterator>) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (policy.sample_sort) {
+        internal::sample_sort(policy, first, last, comp);
+        return;
+      }
+    }
+
     sort(
         policy,
         internal::convert_to_global_iterator(first, checkout_mode::read_write),
@@ -280,4 +710,206 @@ ITYR_TEST_CASE("[ityr::pattern::parallel_sort] sort") {
   ito::fini();
 }
 
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_sort] sample sort") {
+  ito::init();
+  ori::init();
+
+  // Bucket buffers are allocated from the noncollective heap of each process
+  long n = 200000;
+  ori::global_ptr<long> p = ori::malloc_coll<long>(n);
+
+  auto check_sorted = [=](auto comp, long sum) {
+    ito::root_exec([=] {
+      ITYR_CHECK(is_sorted(execution::parallel_policy(1000), p, p + n, comp));
+      ITYR_CHECK(reduce(execution::parallel_policy(1000), p, p + n) == sum);
+    });
+  };
+
+  ITYR_SUBCASE("distinct values") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(1000),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return (i * 7919) % n; });
+
+      sort(execution::parallel_policy(20000).with_sample_sort(), p, p + n);
+    });
+    check_sorted(std::less<>{}, n * (n - 1) / 2);
+  }
+
+  ITYR_SUBCASE("many duplicates") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(1000),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return (3 * i + 5) % 13; });
+
+      sort(execution::par_sample, p, p + n, std::greater<>{});
+    });
+    long sum = ito::root_exec([=] {
+      return transform_reduce(execution::par, count_iterator<long>(0), count_iterator<long>(n),
+                              reducer::plus<long>{}, [](long i) { return (3 * i + 5) % 13; });
+    });
+    check_sorted(std::greater<>{}, sum);
+  }
+
+  ITYR_SUBCASE("small range") {
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(1000),
+          count_iterator<long>(0), count_iterator<long>(100), p,
+          [=](long i) { return 100 - i; });
+
+      sort(execution::par_sample, p, p + 100);
+
+      ITYR_CHECK(is_sorted(execution::par, p, p + 100));
+      ITYR_CHECK(p[0].get() == 1);
+    });
+  }
+
+  ori::free_coll(p);
+
+  ori::fini();
+  ito::fini();
+}
+
+
+/**
+ * @brief Sort a range by the integer or floating-point keys of elements (radix sort).
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin global pointer.
+ * @param last   End global pointer.
+ * @param key_fn Operator to extract a key from each element.
+ *
+ * This function sorts the given range (`[first, last)`) in place in the ascending order of the
+ * keys `key_fn(x)`, which must be of an integral (except `bool`), `float`, or `double` type.
+ * This sort is stable.
+ *
+ * This is a least-significant-digit radix sort with 8-bit digits. In each pass, every block of
+ * elements computes a private histogram of digits, and the histograms are scanned to determine
+ * the destination of each (block, digit) pair. Each block then groups its elements by digit
+ * locally and writes each group to the destination as a contiguous run. Passes in which all keys
+ * have the same digit are skipped.
+ *
+ * Only global pointers to trivially copyable elements are supported. A temporary buffer as large
+ * as the range is allocated from the noncollective heaps of the processes executing the tasks
+ * (see `ITYR_ORI_NONCOLL_ALLOCATOR_SIZE`).
+ *
+ * Example:
+ * ```
+ * ityr::global_vector<double> v = {2.5, -1.0, 3.0, 0.5};
+ * ityr::radix_sort(ityr::execution::par, v.begin(), v.end(), [](double x) { return x; });
+ * // v = {-1.0, 0.5, 2.5, 3.0}
+ * ```
+ *
+ * @see `ityr::sort()`
+ * @see `ityr::stable_sort()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename KeyFn>
+inline void radix_sort(const ExecutionPolicy& policy,
+                       RandomAccessIterator   first,
+                       RandomAccessIterator   last,
+                       KeyFn                  key_fn) {
+  static_assert(ori::is_global_ptr_v<RandomAccessIterator>,
+                "Radix sort is supported only for global pointers");
+  internal::radix_sort(policy, first, last, key_fn);
+}
+
+/**
+ * @brief Sort a range of integers or floating-point numbers (radix sort).
+ *
+ * @param policy Execution policy (`ityr::execution`).
+ * @param first  Begin global pointer.
+ * @param last   End global pointer.
+ *
+ * Equivalent to `ityr::radix_sort(policy, first, last, [](auto x) { return x; })`.
+ *
+ * @see `ityr::radix_sort()`
+ */
+template <typename ExecutionPolicy, typename RandomAccessIterator>
+inline void radix_sort(const ExecutionPolicy& policy,
+                       RandomAccessIterator   first,
+                       RandomAccessIterator   last) {
+  radix_sort(policy, first, last, [](const auto& x) { return x; });
+}
+
+ITYR_TEST_CASE("[ityr::pattern::parallel_sort] radix_sort") {
+  ito::init();
+  ori::init();
+
+  // The temporary buffer is allocated from the noncollective heap of each process
+  long n = 200000;
+
+  ITYR_SUBCASE("unsigned keys") {
+    ori::global_ptr<uint64_t> p = ori::malloc_coll<uint64_t>(n);
+
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(1000),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return uint64_t(i) * 0x9e3779b97f4a7c15; });
+
+      uint64_t sum = reduce(execution::par, p, p + n);
+
+      radix_sort(execution::par, p, p + n);
+
+      ITYR_CHECK(is_sorted(execution::parallel_policy(1000), p, p + n));
+      ITYR_CHECK(reduce(execution::par, p, p + n) == sum);
+
+      // A single pass (the result is copied back from the temporary buffer)
+      radix_sort(execution::par, p, p + n, [](uint64_t x) { return uint8_t(x % 251); });
+
+      auto by_mod = [](uint64_t x, uint64_t y) {
+        return x % 251 < y % 251 || (x % 251 == y % 251 && x < y);
+      };
+      ITYR_CHECK(is_sorted(execution::parallel_policy(1000), p, p + n, by_mod));
+      ITYR_CHECK(reduce(execution::par, p, p + n) == sum);
+    });
+
+    ori::free_coll(p);
+  }
+
+  ITYR_SUBCASE("signed and floating-point keys with stability") {
+    struct item {
+      double key;
+      long   val;
+    };
+
+    ori::global_ptr<item> p = ori::malloc_coll<item>(n);
+
+    ito::root_exec([=] {
+      transform(
+          execution::parallel_policy(1000),
+          count_iterator<long>(0), count_iterator<long>(n), p,
+          [=](long i) { return item{double((i * 7919) % 201 - 100) / 4, i}; });
+
+      radix_sort(execution::parallel_policy(1000), p, p + n,
+                 [](const item& x) { return x.key; });
+
+      auto by_key = [](const item& a, const item& b) {
+        return a.key < b.key || (a.key == b.key && a.val < b.val);
+      };
+      ITYR_CHECK(is_sorted(execution::parallel_policy(1000), p, p + n, by_key));
+      ITYR_CHECK(p[0].get().key == -25.0);
+
+      // Sort by a signed key; the previous order must be kept for equal keys
+      radix_sort(execution::parallel_policy(1000), p, p + n,
+                 [](const item& x) { return int(x.val % 1000 - 500); });
+
+      auto by_val = [=](const item& a, const item& b) {
+        return a.val % 1000 < b.val % 1000 || (a.val % 1000 == b.val % 1000 && by_key(a, b));
+      };
+      ITYR_CHECK(is_sorted(execution::parallel_policy(1000), p, p + n, by_val));
+      ITYR_CHECK(p[0].get().val % 1000 == 0);
+    });
+
+    ori::free_coll(p);
+  }
+
+  ori::fini();
+  ito::fini();
+}
+
 }
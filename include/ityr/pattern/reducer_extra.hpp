@@ -1,10 +1,30 @@
 #pragma once
 
+#include <array>
+
 #include "ityr/common/util.hpp"
 #include "ityr/pattern/parallel_loop.hpp"
 #include "ityr/container/global_vector.hpp"
 #include "ityr/container/global_span.hpp"
 
+namespace ityr::internal {
+
+// Returns the bin of `x` when [lowest, highest] is divided into `n_bins` bins of equal width
+// (for integral types, the range consists of `highest - lowest + 1` values)
+template <typename T>
+inline std::size_t histogram_bin(const T& x, const T& lowest, const T& highest, std::size_t n_bins) {
+  long double w = static_cast<long double>(highest) - static_cast<long double>(lowest);
+  if constexpr (std::is_integral_v<T>) {
+    w += 1;
+  }
+  if (!(w > 0)) return 0;
+  auto key = static_cast<std::size_t>(
+      (static_cast<long double>(x) - static_cast<long double>(lowest)) * n_bins / w);
+  return std::min(key, n_bins - 1);
+}
+
+}
+
 namespace ityr::reducer {
 
 template <typename T, typename Counter = std::size_t>
@@ -49,6 +69,66 @@ private:
   value_type  highest_ = std::numeric_limits<value_type>::max();
 };
 
+/**
+ * @brief Reducer for a histogram with a fixed number of bins held locally by each task.
+ *
+ * @tparam T       Type of the values to be counted (arithmetic).
+ * @tparam NBins   Number of bins.
+ * @tparam Counter Type of the counts.
+ *
+ * Unlike `ityr::reducer::histogram`, whose accumulator is a global vector allocated for each task
+ * that is stolen and merged with remote accesses, the accumulator is a plain array
+ * (`std::array<Counter, NBins>`). Accumulators are merged locally, and they are transferred between
+ * processes only together with stolen tasks. The number of bins must be known at compile time so
+ * that the accumulator is trivially copyable; it should be small enough to be held on task stacks.
+ * For many bins, use `ityr::histogram()`, which atomically adds to a distributed global array.
+ *
+ * @see `ityr::histogram()`
+ */
+template <typename T, std::size_t NBins, typename Counter = std::size_t>
+struct histogram_local {
+  static_assert(std::is_arithmetic_v<T>);
+  static_assert(NBins > 0);
+
+  using value_type       = T;
+  using accumulator_type = std::array<Counter, NBins>;
+
+  histogram_local() {}
+  histogram_local(const value_type& lowest, const value_type& highest)
+    : lowest_(lowest), highest_(highest) {}
+
+  void operator()(accumulator_type& acc, const value_type& x) const {
+    if (lowest_ <= x && x <= highest_) {
+      acc[ityr::internal::histogram_bin(x, lowest_, highest_, NBins)]++;
+    }
+  }
+
+  void operator()(accumulator_type& acc_l, const accumulator_type& acc_r) const {
+    for (std::size_t i = 0; i < NBins; i++) {
+      acc_l[i] += acc_r[i];
+    }
+  }
+
+  void operator()(const accumulator_type& acc_l, accumulator_type& acc_r) const {
+    // commutative
+    for (std::size_t i = 0; i < NBins; i++) {
+      acc_r[i] += acc_l[i];
+    }
+  }
+
+  accumulator_type operator()() const {
+    accumulator_type acc;
+    acc.fill(0);
+    return acc;
+  }
+
+private:
+  value_type lowest_  = std::numeric_limits<value_type>::lowest();
+  value_type highest_ = std::numeric_limits<value_type>::max();
+};
+
+// Concatenates vectors at every join, so each element can be copied many times; see
+// `ityr::transform_concat()` for a version that writes each element once.
 template <typename T>
 struct vec_concat {
   using value_type       = global_vector<T>;
@@ -156,6 +236,41 @@ ITYR_TEST_CASE("[ityr::reducer] extra reducer test") {
     });
   }
 
+  ITYR_SUBCASE("histogram_local") {
+    root_exec([=] {
+      int n_samples = 100000;
+      constexpr std::size_t n_bins = 100;
+      global_vector<double> v(n_samples);
+
+      transform(
+          execution::parallel_policy(128),
+          count_iterator<int>(0), count_iterator<int>(n_samples), v.begin(),
+          [=](int i) {
+            double x = (static_cast<double>(i) + 0.5) / n_bins;
+            return x - static_cast<int>(x); // within [0.0, 1.0)
+          });
+
+      auto bins = reduce(
+          execution::parallel_policy(128),
+          v.begin(), v.end(), histogram_local<double, n_bins>(0.0, 1.0));
+
+      for (auto count : bins) {
+        ITYR_CHECK(count == n_samples / n_bins);
+      }
+
+      // values out of the range are ignored
+      auto bins_int = transform_reduce(
+          execution::parallel_policy(128),
+          count_iterator<int>(-100), count_iterator<int>(n_samples + 100),
+          histogram_local<int, 10, int>(0, n_samples - 1),
+          [](int i) { return i; });
+
+      for (auto count : bins_int) {
+        ITYR_CHECK(count == n_samples / 10);
+      }
+    });
+  }
+
   ITYR_SUBCASE("vec_concat") {
     root_exec([=] {
       int n = 10000;
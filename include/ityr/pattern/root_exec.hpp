@@ -74,6 +74,66 @@ inline auto root_exec(Fn&& fn, Args&&... args) {
   }
 }
 
+/**
+ * @brief Spawn a root thread on every process (collective).
+ *
+ * @param fn      Function object to be called by each root thread.
+ * @param args... Argments to be passed to `fn` (optional).
+ *
+ * @return The return value of `fn(args...)` executed by the root thread spawned by the calling process.
+ *
+ * This function is the same as `ityr::root_exec()`, except that every process spawns its own root
+ * thread. The root threads are independent task graphs executed concurrently; they share all
+ * workers and their tasks can be stolen by any process. Each process receives the return value
+ * of its own root thread (no broadcast) after all root threads are completed.
+ *
+ * This is useful for processing many independent requests with modest parallelism, which
+ * would underutilize the workers if executed by a sequence of `ityr::root_exec()` calls.
+ * Within each root thread, `ityr::async()` can be used to obtain a completion handle per request.
+ * Collective operations (e.g., `ityr::coll_exec()`) cannot be called within the root threads.
+ *
+ * Example:
+ * ```
+ * auto my_rank = ityr::my_rank();
+ * auto ret = ityr::root_exec_each([=] {
+ *   // One root thread is spawned by each process
+ *   return process_requests_received_by(my_rank);
+ * });
+ * // returns when all root threads are completed
+ * ```
+ *
+ * With the ADWS scheduler, the root threads are executed one by one.
+ *
+ * @see `ityr::root_exec()`
+ */
+template <typename Fn, typename... Args>
+inline auto root_exec_each(Fn&& fn, Args&&... args) {
+  ITYR_CHECK(ito::is_spmd());
+
+  ori::release();
+  common::mpi_barrier(common::topology::mpicomm());
+  ori::acquire();
+
+  using retval_t = std::invoke_result_t<Fn, Args...>;
+  if constexpr (std::is_void_v<retval_t>) {
+    ito::root_exec_each(ito::with_callback,
+                        []() { ori::poll(); },
+                        std::forward<Fn>(fn), std::forward<Args>(args)...);
+    ori::release();
+    common::mpi_barrier(common::topology::mpicomm());
+    ori::acquire();
+
+  } else {
+    auto ret = ito::root_exec_each(ito::with_callback,
+                                   []() { ori::poll(); },
+                                   std::forward<Fn>(fn), std::forward<Args>(args)...);
+    ori::release();
+    common::mpi_barrier(common::topology::mpicomm());
+    ori::acquire();
+    return ret;
+  }
+}
+
 /**
  * @brief Execute the same function collectively on all processes.
  *
@@ -135,4 +195,90 @@ inline auto coll_exec(const Fn& fn, const Args&... args) {
   }
 }
 
+/**
+ * @brief Handle for the completion of `ityr::coll_exec_nb()`.
+ */
+template <typename T>
+class coll_exec_handle {
+public:
+  coll_exec_handle() {}
+  explicit coll_exec_handle(ito::coll_exec_handle<T>&& h) : h_(std::move(h)) {}
+
+  /**
+   * @brief Return true if the handle has not been waited for yet.
+   */
+  bool valid() const { return h_.valid(); }
+
+  /**
+   * @brief Wait for all processes to complete the function and return the value on the calling process.
+   */
+  T wait() {
+    if constexpr (std::is_void_v<T>) {
+      h_.wait();
+      ori::acquire();
+    } else {
+      auto ret = h_.wait();
+      ori::acquire();
+      return ret;
+    }
+  }
+
+private:
+  ito::coll_exec_handle<T> h_;
+};
+
+/**
+ * @brief Execute the same function collectively on all processes without waiting for completion.
+ *
+ * @param fn      Function object to be called on all processes.
+ * @param args... Argments to be passed to `fn` (optional).
+ *
+ * @return A handle whose `wait()` returns the return value of `fn(args...)` on the calling process.
+ *
+ * This function is the same as `ityr::coll_exec()`, except that it returns as soon as the calling
+ * process completes `fn(args...)`, without waiting for the other processes. The root thread can
+ * continue its computation while the other processes execute `fn(args...)`. The returned handle
+ * must be waited for before the next call to `ityr::coll_exec()` or `ityr::coll_exec_nb()`, and
+ * memory updates by other processes in `fn(args...)` are visible only after the wait.
+ *
+ * Example:
+ * ```
+ * ityr::root_exec([=] {
+ *   auto h = ityr::coll_exec_nb([] {
+ *     // SPMD region (all processes execute this function)
+ *     return ityr::my_rank();
+ *   });
+ *
+ *   // Do some work while other processes are executing the function
+ *
+ *   auto ret = h.wait();
+ * });
+ * ```
+ *
+ * @see `ityr::coll_exec()`
+ */
+template <typename Fn, typename... Args>
+inline auto coll_exec_nb(const Fn& fn, const Args&... args) {
+  ITYR_CHECK(ito::is_root());
+
+  ori::release();
+
+  using retval_t = std::invoke_result_t<Fn, Args...>;
+  if constexpr (std::is_void_v<retval_t>) {
+    return coll_exec_handle<void>(ito::coll_exec_nb([=]() {
+      ori::acquire();
+      fn(args...);
+      ori::release();
+    }));
+
+  } else {
+    return coll_exec_handle<retval_t>(ito::coll_exec_nb([=]() {
+      ori::acquire();
+      auto ret = fn(args...);
+      ori::release();
+      return ret;
+    }));
+  }
+}
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+
 #include "ityr/common/util.hpp"
 #include "ityr/ito/ito.hpp"
 #include "ityr/ori/ori.hpp"
@@ -58,29 +60,99 @@ inline void apply_iterators(Op                  op,
   }
 }
 
-template <typename Op, typename ForwardIterator, typename... ForwardIterators>
-inline void for_each_aux(const execution::sequenced_policy& policy,
-                         Op                                 op,
-                         ForwardIterator                    first,
-                         ForwardIterator                    last,
-                         ForwardIterators...                firsts) {
+// The checkout for the chunk `pipeline_depth` chunks ahead is issued before the current chunk is
+// processed and is completed after that. As checkout_complete() completes all outstanding
+// checkouts, the chunks in between have already been completed.
+template <typename ChunkOp, typename... ForwardIterators>
+inline void for_each_chunk_pipelined(const execution::sequenced_policy& policy,
+                                     ChunkOp                            op,
+                                     std::size_t                        n,
+                                     ForwardIterators...                firsts) {
+  std::size_t c = policy.checkout_count;
+
+  using chunk_t = decltype(checkout_global_iterators_aux(c, firsts...));
+  std::deque<std::pair<std::size_t, chunk_t>> chunks;
+
+  std::size_t d = 0;
+  auto issue_next_chunk = [&]() {
+    auto n_ = std::min(n - d, c);
+    chunks.emplace_back(n_, checkout_global_iterators_aux(n_, firsts...));
+    ((firsts = std::next(firsts, n_)), ...);
+    d += n_;
+  };
+
+  for (std::size_t k = 0; k < policy.pipeline_depth && d < n; k++) {
+    issue_next_chunk();
+  }
+  ori::checkout_complete();
+
+  while (!chunks.empty()) {
+    if (d < n) {
+      issue_next_chunk();
+    }
+
+    std::apply(op, std::tuple_cat(std::make_tuple(chunks.front().first),
+                                        std::get<1>(chunks.front().second)));
+
+    ori::checkout_complete();
+
+    // check in the current chunk
+    chunks.pop_front();
+  }
+}
+
+// Calls `op(n, its...)` for each checked-out chunk of the given ranges, where `n` is the
+// length of the chunk and `its...` are the begin iterators of the chunk (raw pointers for global
+// iterators). If no iterator needs checkout, the whole range is passed as one chunk.
+template <typename ChunkOp, typename ForwardIterator, typename... ForwardIterators>
+inline void for_each_chunk_aux(const execution::sequenced_policy& policy,
+                               ChunkOp                            op,
+                               ForwardIterator                    first,
+                               ForwardIterator                    last,
+                               ForwardIterators...                firsts) {
+  std::size_t n = std::distance(first, last);
+
   if constexpr ((needs_checkout_v<ForwardIterator> || ... ||
                  needs_checkout_v<ForwardIterators>)) {
     // perform automatic checkout for global iterators
-    std::size_t n = std::distance(first, last);
     std::size_t c = policy.checkout_count;
 
+    if (policy.pipeline_depth > 0) {
+      for_each_chunk_pipelined(policy, op, n, first, firsts...);
+      return;
+    }
+
     for (std::size_t d = 0; d < n; d += c) {
       auto n_ = std::min(n - d, c);
 
       auto [css, its] = checkout_global_iterators(n_, first, firsts...);
-      std::apply([&](auto&&... args) {
-        apply_iterators(op, n_, std::forward<decltype(args)>(args)...);
-      }, its);
+      std::apply(op, std::tuple_cat(std::make_tuple(n_), its));
 
       ((first = std::next(first, n_)), ..., (firsts = std::next(firsts, n_)));
     }
 
+  } else {
+    if (n > 0) {
+      op(n, first, firsts...);
+    }
+  }
+}
+
+template <typename Op, typename ForwardIterator, typename... ForwardIterators>
+inline void for_each_aux(const execution::sequenced_policy& policy,
+                         Op                                 op,
+                         ForwardIterator                    first,
+                         ForwardIterator                    last,
+                         ForwardIterators...                firsts) {
+  if constexpr ((needs_checkout_v<ForwardIterator> || ... ||
+                 needs_checkout_v<ForwardIterators>)) {
+    for_each_chunk_aux(
+        policy,
+        [&](std::size_t n, auto&&... its) {
+          apply_iterators(op, n, std::forward<decltype(its)>(its)...);
+        },
+        first, last, firsts...);
+
   } else {
     for (; first != last; (++first, ..., ++firsts)) {
       op(*first, *firsts...);
@@ -88,6 +160,60 @@ inline void for_each_aux(const execution::sequenced_policy& policy,
   }
 }
 
+// An operator applied to each chunk of the range (by `for_each_chunk_aux()`) rather than to
+// each element
+template <typename Op>
+struct chunk_op {
+  Op op;
+};
+
+template <typename T>
+struct is_chunk_op : public std::false_type {};
+
+template <typename Op>
+struct is_chunk_op<chunk_op<Op>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_chunk_op_v = is_chunk_op<T>::value;
+
+// Returns the offset of the first elements for which `pred` returns true (or the length of the
+// range if not found). `should_stop(i)` is polled before every `checkout_count` elements starting
+// at offset `i`, and the search stops early (as not found) if it returns true.
+template <typename Predicate, typename StopFn, typename ForwardIterator, typename... ForwardIterators>
+inline std::size_t find_aux(const execution::sequenced_policy& policy,
+                            Predicate                          pred,
+                            StopFn                             should_stop,
+                            ForwardIterator                    first,
+                            ForwardIterator                    last,
+                            ForwardIterators...                firsts) {
+  std::size_t n = std::distance(first, last);
+  std::size_t c = policy.checkout_count;
+
+  for (std::size_t d = 0; d < n; d += c) {
+    if (should_stop(d)) {
+      return n;
+    }
+
+    auto n_ = std::min(n - d, c);
+
+    auto [css, its] = checkout_global_iterators(n_, first, firsts...);
+    std::size_t found = std::apply([&](auto... its_) {
+      for (std::size_t i = 0; i < n_; (++i, ..., ++its_)) {
+        if (pred(*its_...)) return i;
+      }
+      return n_;
+    }, its);
+
+    if (found < n_) {
+      return d + found;
+    }
+
+    ((first = std::next(first, n_)), ..., (firsts = std::next(firsts, n_)));
+  }
+
+  return n;
+}
+
 template <typename Iterator, typename Mode>
 inline auto convert_to_global_iterator(Iterator it, Mode mode) {
   if constexpr (is_global_iterator_v<Iterator>) {